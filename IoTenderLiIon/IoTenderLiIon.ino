@@ -4,8 +4,17 @@
  */
 #include <stdint.h>
 #include "LTC4162-LAD.h"
+#include "LTC4162-LAD_fields.hpp"
+#include "LTC4162-LAD_queue.h"
 #include "LTC4162-LAD_formats.h"
 #include "LTC4162-LAD_pec.h"
+#include "LTC4162-LAD_ntc.h"
+#include "LTC4162-LAD_fmt.h"
+#include "LTC4162-LAD_sched.h"
+#include "LTC4162-LAD_solar.h"
+#include "LTC4162-LAD_history.h"
+#include "LTC4162-LAD_event.h"
+#include "LTC4162-LAD_window.h"
 #include <Wire.h>
 #include <ESP8266WiFi.h>
 extern "C"
@@ -25,26 +34,172 @@ extern "C"
 #define TIMER_MINUTES TIMER_SECONDS * 60
 #define DEEP_SLEEP_TIME 15 DEEP_SLEEP_SECONDS       // Extend to 30 seconds
 #define SOLAR_CHECK_TIMEOUT 5 TIMER_MINUTES         // Extend to 5 minutes
-#define VIN_SOLAR_DROPOUT 0.98
+#define VIN_SOLAR_DROPOUT 98                        // Percent of open circuit VIN
+
+//Uncomment following line to service SMBALERT from an interrupt instead of polling the charger state and status.
+//#define LTC4162_EVENT_MODE
+#ifdef LTC4162_EVENT_MODE
+#define SMBALERT D3                                 // LTC4162 SMBALERT, open drain. GPIO0 straps the boot mode: an alert held through a reset starts the flash loader
+#define SMBUS_ARA 0x0C                              // SMBus Alert Response Address
+#define EVENT_MODE_TELEMETRY_MS 30000               // Telemetry refresh while nothing changes, an alert refreshes it at once
+#define EVENT_MODE_POWER_MS 1000                    // Input power check, as an alert also wakes it
+#endif
+
+//Uncomment following line to poll only the limit alerts between slow telemetry passes, when no pin is free for SMBALERT.
+//#define LTC4162_WINDOW_MODE
+#ifdef LTC4162_WINDOW_MODE
+#ifdef LTC4162_EVENT_MODE
+#error "LTC4162_WINDOW_MODE and LTC4162_EVENT_MODE both clear the limit alerts, define only one"
+#endif
+#define WINDOW_MODE_TELEMETRY_MS 10000              // Full telemetry pass, for the charger state and the readings a one sided window misses
+#endif
+enum {SMBUS_OK, SMBUS_TOO_LONG, SMBUS_NACK_ADDRESS, SMBUS_NACK_DATA, SMBUS_OTHER, SMBUS_PEC_ERROR}; // Wire.endTransmission() results returned by write_register(), plus read PEC mismatch
 
 uint16_t data, cell_count;
-bool solar_panel, solar_panel_timeout, input_power_detected, thermistor_present;
+bool solar_panel_timeout, input_power_detected, thermistor_present;
+bool telemetry_read;                                // Set by the first snapshot telemetry_task() reads whole, the history waits for it
 os_timer_t solar_panel_timer;
-char vin[10], vout[10], vbat[10], iin[10], ibat[10], die_temp[10], bsr[10], thermistor_voltage[10], tcharge_timer[15], tcv_timer[15], temp[15];
-std::string value, html, charger_state;
+LTC4162_solar_t solar;                              // Solar panel detection, stepped by power_task() so the web server keeps running
+const char *charger_state = "";
 WiFiClient client;
 WiFiServer server(80); //Initialize the server on Port 80
 int read_register(uint8_t addr, uint8_t command_code, uint16_t *data, struct port_configuration *pc);
 int write_register(uint8_t addr, uint8_t command_code, uint16_t data, struct port_configuration *pc);
-int add_table_row(std::string x, std::string y, bool send_it);
+int read_register_list(uint8_t addr, const uint8_t *command_codes, uint16_t *data, uint8_t count, struct port_configuration *pc);
+int add_table_row(const char *x, const char *y, bool send_it);
+char *history_hex(char *out, uint16_t value, uint8_t digits);
+void print_history();
+void bus_recover(uint8_t tier);
+uint32_t clock_ms();
+uint32_t clock_cycles();
+void power_task(void *context);
+void telemetry_task(void *context);
+void history_task(void *context);
+void led_task(void *context);
+void limits_task(void *context);
+void queue_task(void *context);
+void panel_written(int failure, uint16_t data, void *context);
+void http_task(void *context);
+#ifdef LTC4162_EVENT_MODE
+void alert_task(void *context);
+void smbalert_isr();
+uint8_t alert_response();
+#endif
+#ifdef LTC4162_WINDOW_MODE
+void window_task(void *context);
+#endif
+#ifdef LTC4162_INSTRUMENTATION
+uint32_t clock_us();
+void print_stats();
+#endif
+
+enum {PANEL_EN_CHG, PANEL_FORCE_TELEMETRY_ON, PANEL_RUN_BSR, PANEL_EN_C_OVER_X_TERM, PANEL_SUSPEND_CHARGER, PANEL_EN_JEITA, PANEL_ARM_SHIP_MODE, PANEL_FIELD_COUNT};
+const uint16_t panel_fields[PANEL_FIELD_COUNT] =    // Status and button states shown on the web page, index with the PANEL_ names above
+{
+    LTC4162_EN_CHG,
+    LTC4162_FORCE_TELEMETRY_ON,
+    LTC4162_RUN_BSR,
+    LTC4162_EN_C_OVER_X_TERM,
+    LTC4162_SUSPEND_CHARGER,
+    LTC4162_EN_JEITA,
+    LTC4162_ARM_SHIP_MODE
+};
+uint16_t panel[PANEL_FIELD_COUNT];                  // Last read by queue_task(), or as written by a button, so the page never waits on the bus
+bool panel_stale = true;                            // Set once a page has shown the panel or a button write failed, queue_task() reads it again
+
+LTC4162_transaction_t ltc4162_slots[8];             // Storage for SMBus transactions waiting on the queue below
+LTC4162_queue_t ltc4162_queue;                      // Web page button writes, carried out a few per queue_task() run
+#define QUEUE_SLICE 2                               // Most queued transactions to carry out per queue_task() run
+
+enum {RECOVERY_RETRY, RECOVERY_CLOCKS, RECOVERY_RESET, RECOVERY_TIERS}; // Escalating responses to a failed read, see bus_recover()
+struct
+{
+    uint32_t count[RECOVERY_TIERS];                 // Times each tier was needed
+    uint32_t last_ms[RECOVERY_TIERS];               // millis() when each tier was last needed
+} bus_recovery;
+
+uint8_t ltc4162_pec_prefix[256];                    // PEC remainder through the repeated start of a read, per command code, for ltc4162.address
+
+LTC4162_telemetry_t telemetry;                      // Latest snapshot of the telemetry registers, all read in one bus pass
+LTC4162_history_t history;                          // Packed raw telemetry, served at /HISTORY, storage allocated in setup()
+#define HISTORY_HEAP_RESERVE 16384                  // Free heap left to the WiFi stack and web server once the history is allocated
+LTC4162_cache_t ltc4162_cache;                      // Shadow of the writable registers, saves the read half of every bit-field write and skips unchanged rewrites
+#ifdef LTC4162_INSTRUMENTATION
+LTC4162_stats_t ltc4162_stats = {.clock_us = clock_us};  // SMBus counters and latency histograms, served at /STATS
+#endif
 
 LTC4162_chip_cfg_t ltc4162 =
 {
     .address            = LTC4162_ADDR_68,
     .read_register      = read_register,
     .write_register     = write_register,
-    .port_configuration = NULL
+    .port_configuration = NULL,
+    .cache              = &ltc4162_cache,
+    .read_register_list = read_register_list,
+#ifdef LTC4162_INSTRUMENTATION
+    .stats              = &ltc4162_stats,
+#endif
+};
+
+#define CYCLES_PER_MS (F_CPU / 1000)
+enum {TASK_POWER, TASK_TELEMETRY, TASK_HISTORY, TASK_LEDS, TASK_LIMITS, TASK_QUEUE, TASK_HTTP,
+#ifdef LTC4162_EVENT_MODE
+      TASK_ALERT,
+#endif
+#ifdef LTC4162_WINDOW_MODE
+      TASK_WINDOW,
+#endif
+      TASK_COUNT};
+LTC4162_task_t tasks[TASK_COUNT] =                  // In priority order, run from loop() by the scheduler
+{
+//   name         run             context period_ms deadline_ms budget_cycles
+    {"power",     power_task,     NULL,   100,      100,        2 * CYCLES_PER_MS},     // Input power check, sleep and solar panel detection steps
+    {"telemetry", telemetry_task, NULL,   1000,     500,        10 * CYCLES_PER_MS},    // One bus pass over the telemetry registers, 1Hz
+    {"history",   history_task,   NULL,   10000,    1000,       CYCLES_PER_MS / 10},    // Latest snapshot into the history, 20 bytes every 10s
+    {"leds",      led_task,       NULL,   100,      50,         CYCLES_PER_MS / 10},    // Charger state to GPIO, 10Hz
+    {"limits",    limits_task,    NULL,   5000,     1000,       2 * CYCLES_PER_MS},     // Undervoltage and thermal regulation settings, rewritten only if changed
+    {"queue",     queue_task,     NULL,   20,       100,        5 * CYCLES_PER_MS},     // Web page button writes
+    {"http",      http_task,      NULL,   20,       100,        200 * CYCLES_PER_MS},   // Web server, serves a request when one is waiting
+#ifdef LTC4162_EVENT_MODE
+    {"alert",     alert_task,     NULL,   10,       10,         CYCLES_PER_MS},         // SMBALERT service, only a pin read while no alert is pending
+#endif
+#ifdef LTC4162_WINDOW_MODE
+    {"window",    window_task,    NULL,   1000,     500,        2 * CYCLES_PER_MS},     // One read of LIMIT_ALERTS_REG, plus the channels that moved
+#endif
+};
+LTC4162_sched_t scheduler;
+
+#ifdef LTC4162_EVENT_MODE
+enum {EVENT_SMBALERT};
+LTC4162_event_queue_t events;                       // SMBALERT falling edges, posted by smbalert_isr() and drained by alert_task()
+const LTC4162_alerts_t alert_enables =              // Any charger state or charge status change pulls SMBALERT low
+{
+    .limit         = 0,
+    .charger_state = (1u << LTC4162_CHARGER_STATE_SIZE) - 1,
+    .charge_status = (1u << LTC4162_CHARGE_STATUS_SIZE) - 1,
 };
+struct
+{
+    uint32_t serviced;                              // Services that cleared at least one alert
+    uint32_t spurious;                              // Services that found no alert set
+    uint32_t latency_max_cycles;                    // Longest from a SMBALERT edge to its alerts cleared
+} alert_stats;
+#endif
+
+#ifdef LTC4162_WINDOW_MODE
+LTC4162_window_t window;                            // Limit alert windows around the latest readings
+const uint16_t window_hysteresis[LTC4162_WINDOW_CHANNELS] =   // How far a reading moves before it is read again, in A/D codes
+{
+    LTC4162_VBAT_FORMAT_R2I(0.010),                 // VBAT, 10mV
+    LTC4162_VIN_FORMAT_R2I(0.100),                  // VIN, 100mV
+    LTC4162_VOUT_FORMAT_R2I(0.100),                 // VOUT, 100mV
+    LTC4162_IIN_FORMAT_R2I(0.020),                  // IIN, 20mA
+    LTC4162_IBAT_FORMAT_R2I(0.020),                 // IBAT, 20mA
+    LTC4162_DIE_TEMP_FORMAT_R2I(1) - LTC4162_DIE_TEMP_FORMAT_R2I(0),    // Die temperature, 1C
+    LTC4162_BSR_FORMAT_R2U(0.001),                  // BSR, 1mOhm
+    LTC4162_NTCS0402E3103FLT_R2I(24) - LTC4162_NTCS0402E3103FLT_R2I(25),    // Thermistor, about 1C at room temperature, less is hotter
+};
+#endif
 
 void timerCallback(void *pArg)
 {
@@ -68,51 +223,23 @@ void ESP8266_sleep()
     ESP.deepSleep(DEEP_SLEEP_TIME, WAKE_RF_DEFAULT);                      // WAKE_RF_DEFAULT, WAKE_RFCAL, WAKE_NO_RFCAL, WAKE_RF_DISABLED.
 }
 
-void detect_solar_panel()
-{
-    float vbat, vinoc;
-    uint16_t ibat1, ibat2;
-    LTC4162_write_register(&ltc4162, LTC4162_MPPT_EN, false);
-    LTC4162_write_register(&ltc4162, LTC4162_INPUT_UNDERVOLTAGE_SETTING, LTC4162_VIN_UVCL_R2U(36));
-    delay(0.25 TIMER_SECONDS);
-    LTC4162_read_register(&ltc4162, LTC4162_CELL_COUNT, &cell_count);
-    LTC4162_read_register(&ltc4162, LTC4162_VBAT, &data);
-    vbat = LTC4162_VBAT_FORMAT_I2R(data) * cell_count / 2;
-    LTC4162_read_register(&ltc4162, LTC4162_VIN, &data);
-    vinoc = LTC4162_VIN_FORMAT_I2R(data);
-    LTC4162_write_register(&ltc4162, LTC4162_INPUT_UNDERVOLTAGE_SETTING, LTC4162_VIN_UVCL_R2U(vbat + 2));
-    delay(2 TIMER_SECONDS);                                      // Get through battery detection
-    
-    LTC4162_write_register(&ltc4162, LTC4162_INPUT_UNDERVOLTAGE_SETTING, LTC4162_VIN_UVCL_R2U(VIN_SOLAR_DROPOUT * vinoc));
-    delay(0.25 TIMER_SECONDS);
-    LTC4162_read_register(&ltc4162, LTC4162_IBAT, &ibat1);
-    LTC4162_write_register(&ltc4162, LTC4162_INPUT_UNDERVOLTAGE_SETTING, LTC4162_VIN_UVCL_R2U(vbat + 2));
-    delay(0.25 TIMER_SECONDS);
-    LTC4162_read_register(&ltc4162, LTC4162_IBAT, &ibat2);
-    
-    if (ibat2 > ibat1 * 1.05)
-    {
-        // Serial.println("Possible Solar Panel");
-        solar_panel = true;
-        LTC4162_write_register(&ltc4162, LTC4162_MPPT_EN, true);
-    }
-    else
-    {   // Serial.println("Low Impedance Input");
-        solar_panel = false;
-        LTC4162_write_register(&ltc4162, LTC4162_INPUT_UNDERVOLTAGE_SETTING, LTC4162_VIN_UVCL_R2U(vbat + 2));
-    }
-    // Serial.println("");
-}
-
 void setup()
 {
-    pinMode(D0, INPUT_PULLUP); pinMode(D3, OUTPUT); pinMode(D4, OUTPUT); pinMode(EQUALIZE, OUTPUT); pinMode(BULK, OUTPUT); pinMode(ABSORB, OUTPUT); pinMode(D8, OUTPUT); pinMode(LED_BUILTIN, OUTPUT);
-    digitalWrite(D3, LOW); digitalWrite(D4, LOW); digitalWrite(D8, LOW); digitalWrite(LED_BUILTIN, HIGH);
+    pinMode(D0, INPUT_PULLUP); pinMode(D4, OUTPUT); pinMode(EQUALIZE, OUTPUT); pinMode(BULK, OUTPUT); pinMode(ABSORB, OUTPUT); pinMode(D8, OUTPUT); pinMode(LED_BUILTIN, OUTPUT);
+    digitalWrite(D4, LOW); digitalWrite(D8, LOW); digitalWrite(LED_BUILTIN, HIGH);
+#ifdef LTC4162_EVENT_MODE
+    pinMode(SMBALERT, INPUT_PULLUP);                                // Open drain, idles high. Never driven, it is also the GPIO0 boot strap
+#else
+    pinMode(D3, OUTPUT); digitalWrite(D3, LOW);
+#endif
     Wire.begin(SDA, SCL);                                           // Make an I2C port
+    pec_read_prefix_init(ltc4162_pec_prefix, ltc4162.address);
+    LTC4162_queue_init(&ltc4162_queue, &ltc4162, ltc4162_slots, sizeof(ltc4162_slots) / sizeof(ltc4162_slots[0]));
   
     if (!input_power_present() and !telemetry_enabled())
         ESP8266_sleep();
         
+    LTC4162_solar_init(&solar, VIN_SOLAR_DROPOUT);
     os_timer_setfn(&solar_panel_timer, timerCallback, NULL);
     os_timer_arm(&solar_panel_timer, SOLAR_CHECK_TIMEOUT, true);    // This true means repeat
     solar_panel_timeout = true;                                     // Check for solar panel immediately
@@ -125,77 +252,93 @@ void setup()
     WiFi.mode(WIFI_AP);                                             // Our ESP8266-12E is an AccessPoint
     WiFi.softAP("IoTender", "12345678");                            // Provide the (SSID, password);
     server.begin();                                                 // Start the HTTP Server
+    uint32_t heap = ESP.getFreeHeap();                              // What the history can have, WiFi and server already running
+    uint32_t history_size = heap > HISTORY_HEAP_RESERVE ? (heap - HISTORY_HEAP_RESERVE) / sizeof(LTC4162_history_sample_t) : 0;
+    if (history_size > UINT16_MAX)
+        history_size = UINT16_MAX;
+    LTC4162_history_sample_t *history_samples = (LTC4162_history_sample_t *)malloc(history_size * sizeof(LTC4162_history_sample_t));
+    LTC4162_history_init(&history, history_samples, history_samples ? history_size : 0);
+    LTC4162_sched_init(&scheduler, tasks, TASK_COUNT, clock_ms, clock_cycles);
+#ifdef LTC4162_EVENT_MODE
+    tasks[TASK_TELEMETRY].period_ms = EVENT_MODE_TELEMETRY_MS;
+    tasks[TASK_POWER].period_ms = EVENT_MODE_POWER_MS;
+    LTC4162_event_init(&events);
+    attachInterrupt(digitalPinToInterrupt(SMBALERT), smbalert_isr, FALLING);
+    LTC4162_enable_alerts(&ltc4162, &alert_enables);                // An alert already pending made no edge, alert_task() sees the pin low
+#elif defined(LTC4162_WINDOW_MODE)                                 // Exclusive with event mode, see the #error above
+    tasks[TASK_TELEMETRY].period_ms = WINDOW_MODE_TELEMETRY_MS;
+    LTC4162_window_init(&window, window_hysteresis);                // Armed by the first telemetry pass
+#endif
     // IPAddress HTTPS_ServerIP = WiFi.softAPIP();                     // Obtain the IP of the Server
     // Serial.print("Server IP is: ");                                 // Print the IP to the monitor window
     // Serial.println(HTTPS_ServerIP);                                 // Should be 192.168.4.1
 }
 
-void loop()
+void power_task(void *context)
 {
+    (void)context;
     input_power_detected = input_power_present();
-    if (!input_power_detected and !telemetry_enabled())
-        ESP8266_sleep();
-        
     if (!input_power_detected)
     {
+        LTC4162_solar_abort(&solar, &ltc4162);     // Don't leave the charger held off by a probe's 36V undervoltage setting
+        solar.solar_panel = false;
         solar_panel_timeout = true;     // Do instant solar panel detection on next input power
-        solar_panel = false;
+        if (!telemetry_enabled())
+            ESP8266_sleep();
+        return;
     }
         
-    if (solar_panel_timeout and input_power_detected)
+    if (solar_panel_timeout and solar.state == LTC4162_SOLAR_IDLE)
     {
         //Serial.println("Checking for solar panel...");
-        detect_solar_panel();
+        LTC4162_solar_start(&solar, &ltc4162, millis());
         solar_panel_timeout = false;
     }
-    yield();  // or delay(0);
+    LTC4162_solar_step(&solar, &ltc4162, millis(), input_power_detected);    // At most one probe step, never waits
+}
 
-    LTC4162_read_register(&ltc4162, LTC4162_CELL_COUNT, &data);
+void telemetry_task(void *context)
+{
+    (void)context;
+    if (LTC4162_read_telemetry(&ltc4162, &telemetry, millis()) != 0)
+        return;                                                     // Keep the last snapshot, and the windows armed around it
+    telemetry_read = true;
+#ifdef LTC4162_WINDOW_MODE
+    LTC4162_window_arm(&window, &ltc4162, &telemetry);              // Re-centre every window on the full snapshot
+#endif
+    
+    data = LTC4162_CELL_COUNT_DECODE(telemetry.chem_cells);
     if (data != LTC4162_CELL_COUNT_ENUM_UNKNOWN)
         cell_count = data;
     //else
     //    retain last valid value of cell_count
     
-    LTC4162_read_register(&ltc4162, LTC4162_VBAT, &data);
-    dtostrf(LTC4162_VBAT_FORMAT_I2R(data) * cell_count, 5, 3, vbat);
-    
-    LTC4162_write_register(&ltc4162, LTC4162_INPUT_UNDERVOLTAGE_SETTING, LTC4162_VIN_UVCL_R2U(17));
-    
-    LTC4162_read_register(&ltc4162, LTC4162_VIN, &data);
-    dtostrf(LTC4162_VIN_FORMAT_I2R(data), 5, 3, vin);
-    
-    LTC4162_read_register(&ltc4162, LTC4162_VOUT, &data);
-    dtostrf(LTC4162_VOUT_FORMAT_I2R(data), 5, 3, vout);
-    
-    LTC4162_read_register(&ltc4162, LTC4162_IBAT, &data);
-    dtostrf(LTC4162_IBAT_FORMAT_I2R(data), 5, 3, ibat);
-    
-    LTC4162_read_register(&ltc4162, LTC4162_IIN, &data);
-    dtostrf(LTC4162_IIN_FORMAT_I2R(data), 5, 3, iin);
-    
-    LTC4162_read_register(&ltc4162, LTC4162_DIE_TEMP, &data);
-    dtostrf(LTC4162_DIE_TEMP_FORMAT_I2R(data), 5, 3, die_temp);
-    
-    LTC4162_read_register(&ltc4162, LTC4162_THERMISTOR_VOLTAGE, &data);
-    dtostrf(LTC4162_NTCS0402E3103FLT_I2R(data), 5, 3, thermistor_voltage);
-
-    thermistor_present = data < LTC4162_NTCS0402E3103FLT_R2I(-45); // Missing thermistor, less than because NTC!
+    thermistor_present = telemetry.thermistor_voltage < LTC4162_NTCS0402E3103FLT_R2I(-45); // Missing thermistor, less than because NTC!
     // if (thermistor_present)
         // LTC4162_write_register(&ltc4162, LTC4162_EN_SLA_TEMP_COMP, true);
     // else
         // LTC4162_write_register(&ltc4162, LTC4162_EN_SLA_TEMP_COMP, false);
-    
-    LTC4162_read_register(&ltc4162, LTC4162_BSR, &data);
-    dtostrf(LTC4162_BSR_FORMAT_U2R(data) * cell_count * 1000, 5, 3, bsr);
-    
-    LTC4162_read_register(&ltc4162, LTC4162_TCHARGETIMER, &data);
-    sprintf(tcharge_timer, "%dh %dm %ds", data/3600, data%3600/60, data%60);
-    
-    LTC4162_read_register(&ltc4162, LTC4162_TCVTIMER, &data);
-    sprintf(tcv_timer, "%dh %dm %ds", data/3600, data%3600/60, data%60);
-       
-    LTC4162_read_register(&ltc4162, LTC4162_CHARGER_STATE, &data);
-    switch (data)
+}
+
+#ifdef LTC4162_WINDOW_MODE
+void window_task(void *context)
+{
+    (void)context;
+    LTC4162_window_poll(&window, &ltc4162, &telemetry, millis());   // Brings only the channels that moved up to date
+}
+#endif
+
+void history_task(void *context)
+{
+    (void)context;
+    if (telemetry_read and (telemetry.timestamp != history.last_ms or history.count == 0))  // Only snapshots telemetry_task() has taken since
+        LTC4162_history_append(&history, &telemetry);
+}
+
+void led_task(void *context)
+{
+    (void)context;
+    switch (LTC4162_CHARGER_STATE_DECODE(telemetry.charger_state))
     {
     case 1:
         charger_state = "Shorted Battery";
@@ -282,10 +425,87 @@ void loop()
         digitalWrite(FLOAT, LOW);
         break;
     }
-    
-    LTC4162_write_register(&ltc4162, LTC4162_THERMAL_REG_START_TEMP, LTC4162_DIE_TEMP_FORMAT_R2I(109));
-    LTC4162_write_register(&ltc4162, LTC4162_THERMAL_REG_END_TEMP, LTC4162_DIE_TEMP_FORMAT_R2I(111));
+}
+
+void limits_task(void *context)
+{
+    (void)context;
+    if (solar.state == LTC4162_SOLAR_IDLE)             // A running probe owns the undervoltage setting until it is over
+        LTC4162::write<LTC4162::INPUT_UNDERVOLTAGE_SETTING, LTC4162_VIN_UVCL_R2U(17)>(&ltc4162);
+    LTC4162::write<LTC4162::THERMAL_REG_START_TEMP, LTC4162_DIE_TEMP_FORMAT_R2I(109)>(&ltc4162);
+    LTC4162::write<LTC4162::THERMAL_REG_END_TEMP, LTC4162_DIE_TEMP_FORMAT_R2I(111)>(&ltc4162);
+}
 
+void queue_task(void *context)
+{
+    (void)context;
+    LTC4162_queue_service(&ltc4162_queue, QUEUE_SLICE);
+    if (panel_stale and LTC4162_queue_pending(&ltc4162_queue) == 0)    // Button writes first, a read behind them would only be overtaken
+        panel_stale = LTC4162_read_fields(&ltc4162, panel_fields, panel, PANEL_FIELD_COUNT) != 0; // One read per register rather than per field
+}
+
+/*! Queue completion for a button write: the panel shows the value written, or is read again if the write failed. */
+void panel_written(int failure, uint16_t data, void *context)
+{
+    if (failure)
+        panel_stale = true;
+    else
+        *(uint16_t *)context = data;
+}
+
+#ifdef LTC4162_EVENT_MODE
+ICACHE_RAM_ATTR void smbalert_isr()
+{
+    LTC4162_event_post(&events, EVENT_SMBALERT, 0, ESP.getCycleCount());
+}
+
+/*! Reads and clears the LTC4162 alerts once SMBALERT has fallen, or is still low, then wakes the tasks that follow
+ *  the charger state. No bus traffic at all while SMBALERT stays high.
+ */
+void alert_task(void *context)
+{
+    (void)context;
+    LTC4162_event_t event;
+    LTC4162_alerts_t alerts;
+    uint32_t stamp = 0;
+    bool edge = false;
+    while (LTC4162_event_take(&events, &event))                      // However many edges, one service clears them all
+    {
+        if (!edge)
+            stamp = event.stamp;
+        edge = true;
+    }
+    if (!edge and digitalRead(SMBALERT) == HIGH)                    // Low with no edge: raised again while the last was being cleared
+        return;
+    alert_response();                                               // The LTC4162 answers with its address and releases SMBALERT
+    if (LTC4162_read_alerts(&ltc4162, &alerts))
+        return;                                                     // Try again next run, SMBALERT is still low
+    if (!alerts.limit and !alerts.charger_state and !alerts.charge_status)
+    {
+        alert_stats.spurious++;
+        return;
+    }
+    LTC4162_clear_alerts(&ltc4162, &alerts);
+    alert_stats.serviced++;
+    if (edge and clock_cycles() - stamp > alert_stats.latency_max_cycles)
+        alert_stats.latency_max_cycles = clock_cycles() - stamp;
+    LTC4162_sched_wake(&scheduler, &tasks[TASK_TELEMETRY]);         // A fresh snapshot now rather than at the next slow release,
+    LTC4162_sched_wake(&scheduler, &tasks[TASK_LEDS]);              // and the LEDs straight after it in table order
+    LTC4162_sched_wake(&scheduler, &tasks[TASK_POWER]);
+}
+
+/*! SMBus Alert Response: reads the 7-bit address of the device holding SMBALERT low. Returns 0 if none answers. */
+uint8_t alert_response()
+{
+    if (Wire.requestFrom((int)SMBUS_ARA, (int)1, (int)STOP) != 1)
+        return 0;
+    return Wire.read() >> 1;
+}
+#endif
+
+void http_task(void *context)
+{
+    (void)context;
     client = server.available();
     if (!client)
         return;
@@ -294,35 +514,49 @@ void loop()
     // Serial.println(request);
     client.flush();                                                     //clear previous info in the stream
     
+#ifdef LTC4162_INSTRUMENTATION
+    if (request.indexOf("/STATS") != -1)
+    {
+        print_stats();
+        return;
+    }
+#endif
+    
+    if (request.indexOf("/HISTORY") != -1)
+    {
+        print_history();
+        return;
+    }
+    
     if (request.indexOf("/TEL_ON") != -1)
-        LTC4162_write_register(&ltc4162, LTC4162_FORCE_TELEMETRY_ON, true);
+        LTC4162_queue_write(&ltc4162_queue, LTC4162_FORCE_TELEMETRY_ON, true, panel_written, &panel[PANEL_FORCE_TELEMETRY_ON]);
     if (request.indexOf("/TEL_OFF") != -1)
-        LTC4162_write_register(&ltc4162, LTC4162_FORCE_TELEMETRY_ON, false);
+        LTC4162_queue_write(&ltc4162_queue, LTC4162_FORCE_TELEMETRY_ON, false, panel_written, &panel[PANEL_FORCE_TELEMETRY_ON]);
         
     if (request.indexOf("/BSR_ON") != -1)
-        LTC4162_write_register(&ltc4162, LTC4162_RUN_BSR, true);
+        LTC4162_queue_write(&ltc4162_queue, LTC4162_RUN_BSR, true, panel_written, &panel[PANEL_RUN_BSR]);
     if (request.indexOf("/BSR_OFF") != -1)
-        LTC4162_write_register(&ltc4162, LTC4162_RUN_BSR, false);
+        LTC4162_queue_write(&ltc4162_queue, LTC4162_RUN_BSR, false, panel_written, &panel[PANEL_RUN_BSR]);
 
     if (request.indexOf("/CX_ON") != -1)
-        LTC4162_write_register(&ltc4162, LTC4162_EN_C_OVER_X_TERM, true);
+        LTC4162_queue_write(&ltc4162_queue, LTC4162_EN_C_OVER_X_TERM, true, panel_written, &panel[PANEL_EN_C_OVER_X_TERM]);
     if (request.indexOf("/CX_OFF") != -1)
-        LTC4162_write_register(&ltc4162, LTC4162_EN_C_OVER_X_TERM, false);
+        LTC4162_queue_write(&ltc4162_queue, LTC4162_EN_C_OVER_X_TERM, false, panel_written, &panel[PANEL_EN_C_OVER_X_TERM]);
         
-    if (request.indexOf("/ENABLE_ON") != -1)
-        LTC4162_write_register(&ltc4162, LTC4162_SUSPEND_CHARGER, false);
+    if (request.indexOf("/ENABLE_ON") != -1)                            // PEC protected, an acknowledged write has landed
+        LTC4162_queue_write_policy(&ltc4162_queue, LTC4162_SUSPEND_CHARGER, false, LTC4162_WRITE_TRUST_PEC, panel_written, &panel[PANEL_SUSPEND_CHARGER]);
     if (request.indexOf("/ENABLE_OFF") != -1)
-        LTC4162_write_register(&ltc4162, LTC4162_SUSPEND_CHARGER, true);
+        LTC4162_queue_write_policy(&ltc4162_queue, LTC4162_SUSPEND_CHARGER, true, LTC4162_WRITE_TRUST_PEC, panel_written, &panel[PANEL_SUSPEND_CHARGER]);
         
     if (request.indexOf("/JEITA_ON") != -1)
-        LTC4162_write_register(&ltc4162, LTC4162_EN_JEITA, true);
+        LTC4162_queue_write(&ltc4162_queue, LTC4162_EN_JEITA, true, panel_written, &panel[PANEL_EN_JEITA]);
     if (request.indexOf("/JEITA_OFF") != -1)
-        LTC4162_write_register(&ltc4162, LTC4162_EN_JEITA, false);
+        LTC4162_queue_write(&ltc4162_queue, LTC4162_EN_JEITA, false, panel_written, &panel[PANEL_EN_JEITA]);
         
-    if (request.indexOf("/SHIP_ON") != -1)
-        LTC4162_write_register(&ltc4162, LTC4162_ARM_SHIP_MODE, true);
+    if (request.indexOf("/SHIP_ON") != -1)                              // Ship mode shuts the unit off when VIN drops, so read the key back
+        LTC4162_queue_write_policy(&ltc4162_queue, LTC4162_ARM_SHIP_MODE, LTC4162_ARM_SHIP_MODE_ENUM_ARM, LTC4162_WRITE_VERIFY_READBACK, panel_written, &panel[PANEL_ARM_SHIP_MODE]);
     if (request.indexOf("/SHIP_OFF") != -1)
-        LTC4162_write_register(&ltc4162, LTC4162_ARM_SHIP_MODE, false);
+        LTC4162_queue_write_policy(&ltc4162_queue, LTC4162_ARM_SHIP_MODE, 0, LTC4162_WRITE_VERIFY_READBACK, panel_written, &panel[PANEL_ARM_SHIP_MODE]);
 
     // Serial.println("Somebody has connected :)");                    //Read what the browser has sent into a String class and print the request to the monitor
     client.print(F("HTTP/1.1 200\r\n"));
@@ -356,87 +590,95 @@ void loop()
     client.print(F("<h2 align=\"center\">IoTender&trade;</h2>"));
     client.print(F("<table>"));
 
+    char field[LTC4162_FMT_SIZE + 8];                                   // Value and unit of one table row, formatted in place
+    const char *regulation_loop;
+
     add_table_row("<b>PARAMETER</b>", "<b>VALUE</b>", true);
-    add_table_row("Battery Voltage", value.assign(vbat) + "V", true);
-    add_table_row("Input Voltage", value.assign(vin) + "V", true);
-    // add_table_row("Output Voltage", value.assign(vout) + "V", true);
-    add_table_row("Battery Current", value.assign(ibat) + "A", true);
-    add_table_row("Input Current", value.assign(iin) + "A", true);
-    add_table_row("Die Temperature", value.assign(die_temp) + "&deg;C", true);
+    LTC4162_fmt_fix(field, LTC4162_VBAT_FORMAT_I2FIX(telemetry.vbat) * cell_count, 3, 3, "V");
+    add_table_row("Battery Voltage", field, true);
+    LTC4162_fmt_fix(field, LTC4162_VIN_FORMAT_I2FIX(telemetry.vin), 3, 3, "V");
+    add_table_row("Input Voltage", field, true);
+    // LTC4162_fmt_fix(field, LTC4162_VOUT_FORMAT_I2FIX(telemetry.vout), 3, 3, "V");
+    // add_table_row("Output Voltage", field, true);
+    LTC4162_fmt_fix(field, LTC4162_IBAT_FORMAT_I2FIX(telemetry.ibat), 3, 3, "A");
+    add_table_row("Battery Current", field, true);
+    LTC4162_fmt_fix(field, LTC4162_IIN_FORMAT_I2FIX(telemetry.iin), 3, 3, "A");
+    add_table_row("Input Current", field, true);
+    LTC4162_fmt_fix(field, LTC4162_DIE_TEMP_FORMAT_I2FIX(telemetry.die_temp), 3, 3, "&deg;C");
+    add_table_row("Die Temperature", field, true);
     if (thermistor_present)
-        add_table_row("Thermistor Temp", value.assign(thermistor_voltage) + "&deg;C", true);
-    add_table_row("Battery Impedance", value.assign(bsr) + "m&Omega;", true);
+    {
+        LTC4162_fmt_fix(field, LTC4162_ntc_i2fix(&LTC4162_ntcs0402e3103flt, telemetry.thermistor_voltage), 3, 3, "&deg;C");
+        add_table_row("Thermistor Temp", field, true);
+    }
+    LTC4162_fmt_fix(field, LTC4162_BSR_FORMAT_U2FIX(telemetry.bsr) * cell_count, 3, 3, "m&Omega;"); // Microohms shown as milliohms
+    add_table_row("Battery Impedance", field, true);
     add_table_row("Charger State", charger_state, true);
-    LTC4162_read_register(&ltc4162, LTC4162_CHARGE_STATUS, &data);
-    switch (data)
+    switch (LTC4162_CHARGE_STATUS_DECODE(telemetry.charge_status))
     {
         case 0:
-            value = "Charger Off";          break;
+            regulation_loop = "Charger Off";            break;
         case 1:
-            value = "Constant Voltage";     break;
+            regulation_loop = "Constant Voltage";       break;
         case 2:
-            value = "Constant Current";     break;
+            regulation_loop = "Constant Current";       break;
         case 4:
-            value = "Input Current";        break;
+            regulation_loop = "Input Current";          break;
         case 8:
-            value = "Input Voltage";        break;
+            regulation_loop = "Input Voltage";          break;
         case 16:
-            value = "Thermal Regulation";   break;
+            regulation_loop = "Thermal Regulation";     break;
         case 32:
-            value = "Dropout";              break;
+            regulation_loop = "Dropout";                break;
         default:
-            value = "None";                 break;
+            regulation_loop = "None";                   break;
     }
-    add_table_row("Regulation Loop", value, true);
-    add_table_row("Charge Time", value.assign(tcharge_timer, 11), true);
-    add_table_row("C.V. Time", value.assign(tcv_timer, 11), true);
+    add_table_row("Regulation Loop", regulation_loop, true);
+    LTC4162_fmt_duration(field, telemetry.tchargetimer);
+    add_table_row("Charge Time", field, true);
+    LTC4162_fmt_duration(field, telemetry.tcvtimer);
+    add_table_row("C.V. Time", field, true);
     
     if (input_power_present())
-        add_table_row("Power Source",  solar_panel ? "Solar Panel" : "Wall Adapter", true);
+        add_table_row("Power Source",  solar.solar_panel ? "Solar Panel" : "Wall Adapter", true);
     else
         add_table_row("Power Source", "None", true);
     
-    LTC4162_read_register(&ltc4162, LTC4162_EN_CHG, &data);
-    add_table_row("Charger Enabled", data ? "<font color=\"blue\"><b><i>True</i></b></font>" : "<font color=\"red\"><b><i>False</i></b></font>", true);
+    panel_stale = true;                                                 // Shown as queue_task() last had it, read again for the next page
+    add_table_row("Charger Enabled", panel[PANEL_EN_CHG] ? "<font color=\"blue\"><b><i>True</i></b></font>" : "<font color=\"red\"><b><i>False</i></b></font>", true);
 
     client.print(F("</table>"));   
     
-    LTC4162_read_register(&ltc4162, LTC4162_FORCE_TELEMETRY_ON, &data);
-    if (data)
+    if (panel[PANEL_FORCE_TELEMETRY_ON])
         client.print(F("<button class=\"button_green\" onclick=location.href=\"/TEL_OFF\"; style=\"position:absolute; left:0%\">TELEMETRY</button>"));
     else
         client.print(F("<button class=\"button_red\" onclick=location.href=\"/TEL_ON\"; style=\"position:absolute; left:0%\">TELEMETRY</button>"));
 
-    LTC4162_read_register(&ltc4162, LTC4162_RUN_BSR, &data);
-    if (data)
+    if (panel[PANEL_RUN_BSR])
         client.print(F("<button class=\"button_green\" onclick=location.href=\"/BSR_OFF\"; style=\"position:absolute; right:0%\">GET B.S.R.</button>"));
     else
         client.print(F("<button class=\"button_red\" onclick=location.href=\"/BSR_ON\"; style=\"position:absolute; right:0%\">GET B.S.R.</button>"));
 
     client.print(F("<br><br>"));
         
-    LTC4162_read_register(&ltc4162, LTC4162_EN_C_OVER_X_TERM, &data);
-    if (data)
+    if (panel[PANEL_EN_C_OVER_X_TERM])
         client.print(F("<button class=\"button_green\" onclick=location.href=\"/CX_OFF\"; style=\"position:absolute; left:0%\">C/X TERM</button>"));
     else
         client.print(F("<button class=\"button_red\" onclick=location.href=\"/CX_ON\"; style=\"position:absolute; left:0%\">C/X TERM</button>"));
 
-    LTC4162_read_register(&ltc4162, LTC4162_SUSPEND_CHARGER, &data);
-    if (data)
+    if (panel[PANEL_SUSPEND_CHARGER])
         client.print(F("<button class=\"button_red\" onclick=location.href=\"/ENABLE_ON\"; style=\"position:absolute; right:0%\">ENABLE</button>"));
     else
         client.print(F("<button class=\"button_green\" onclick=location.href=\"/ENABLE_OFF\"; style=\"position:absolute; right:0%\">ENABLE</button>"));
 
     client.print(F("<br><br>"));
         
-    LTC4162_read_register(&ltc4162, LTC4162_EN_JEITA, &data);
-    if (data)
+    if (panel[PANEL_EN_JEITA])
         client.print(F("<button class=\"button_green\" onclick=location.href=\"/JEITA_OFF\"; style=\"position:absolute; left:0%\">TEMP COMP</button>"));
     else
         client.print(F("<button class=\"button_red\" onclick=location.href=\"/JEITA_ON\"; style=\"position:absolute; left:0%\">TEMP COMP</button>"));
 
-    LTC4162_read_register(&ltc4162, LTC4162_ARM_SHIP_MODE, &data);
-    if (data)
+    if (panel[PANEL_ARM_SHIP_MODE] == LTC4162_ARM_SHIP_MODE_ENUM_ARM)
         client.print(F("<button class=\"button_green\" onclick=location.href=\"/SHIP_OFF\"; style=\"position:absolute; right:0%\">SHIP MODE</button>"));
     else
         client.print(F("<button class=\"button_red\" onclick=location.href=\"/SHIP_ON\"; style=\"position:absolute; right:0%\">SHIP MODE</button>"));
@@ -446,9 +688,37 @@ void loop()
     // Serial.println("Client disconnected");
 }
 
+void loop()
+{
+    LTC4162_sched_run(&scheduler);
+    delay(LTC4162_sched_idle_ms(&scheduler));                          // Leaves the time to the WiFi stack until the next release
+}
+
+/*! Single read_word transaction with PEC check. Returns 0 on success or SMBUS_PEC_ERROR. */
+int read_register_once(uint8_t address, uint8_t command_code, uint16_t *data)
+{
+    uint8_t the_byte;
+    Wire.beginTransmission((int)address);
+    Wire.write(command_code);
+    Wire.endTransmission(RESTART);
+    Wire.requestFrom((int)address,(int)3,(int)STOP);
+    the_byte = Wire.read();
+    *data = (Wire.read() << 8) | the_byte;
+    if(Wire.read() != pec_read_word_prefixed(ltc4162_pec_prefix, command_code, *data)) // PEC error indicates I2C port is out of sorts.
+    {
+#ifdef LTC4162_INSTRUMENTATION
+        ltc4162_stats.pec_failures++;
+#endif
+        return SMBUS_PEC_ERROR;
+    }
+    return SMBUS_OK;
+}
+
 /*! read_register function wraps C++ method LT_SMBus::readWord and places the returned data in *data.
  * Prototype: virtual uint16_t LT_SMBus::readWord(uint8_t address, uint8_t command);
  * Function should return 0 on success and a non-0 error code on failure. The API functions will return your error code.
+ * A failed read is tried again after each step of bus_recover() in turn, so a single noisy bit costs one extra
+ * transaction rather than a reset.
  */
 int read_register(uint8_t address,                          //!< IC's SMBus address (7-bit format).
                   uint8_t command_code,                     //!< IC's Register address (SMBus command code) for read.
@@ -457,34 +727,103 @@ int read_register(uint8_t address,                          //!< IC's SMBus addr
                  )
 {
     (void)pc;                                   //Unneeded parameter in this implementation.
+    int result;
+    for (uint8_t tier = 0; (result = read_register_once(address, command_code, data)) != SMBUS_OK and tier < RECOVERY_TIERS; tier++)
+        bus_recover(tier);
+    return result;
+}
+
+/*! Chained read_word transactions with PEC checks. Returns 0 on success or SMBUS_PEC_ERROR. */
+int read_register_list_once(uint8_t address, const uint8_t *command_codes, uint16_t *data, uint8_t count)
+{
     uint8_t the_byte;
-    Wire.beginTransmission((int)address);
-    Wire.write(command_code);
-    Wire.endTransmission(RESTART);
-    Wire.requestFrom((int)address,(int)3,(int)STOP);
-    the_byte = Wire.read();
-    *data = (Wire.read() << 8) | the_byte;
-    if(Wire.read() != pec_read_word(address, command_code, *data)) // PEC error indicates I2C port is out of sorts.
-    {                                                           // Only successful clearing of port has been full chip reset.
-        pinMode(SDA, INPUT_PULLUP);                             // To be more polite we could have a PEC error counter just
-        pinMode(SCL, OUTPUT);                                   // in case an occasional PEC error clears itself up.
-        for (int i=0; i<64; i++){                               // This block flushes out the 4162 assuming it's jammed up too.
-            digitalWrite(SCL, LOW);
-            digitalWrite(SCL, LOW);
+    for (uint8_t i = 0; i < count; i++)
+    {
+        Wire.beginTransmission((int)address);
+        Wire.write(command_codes[i]);
+        Wire.endTransmission(!STOP);                            // Repeated start into the read
+        Wire.requestFrom((int)address,(int)3,(int)(i == count - 1)); // Stop only after the last word
+        the_byte = Wire.read();
+        data[i] = (Wire.read() << 8) | the_byte;
+        if(Wire.read() != pec_read_word_prefixed(ltc4162_pec_prefix, command_codes[i], data[i]))
+        {
+#ifdef LTC4162_INSTRUMENTATION
+            ltc4162_stats.pec_failures++;
+#endif
+            return SMBUS_PEC_ERROR;                             // Next transaction's start releases the open read
+        }
+    }
+    return SMBUS_OK;
+}
+
+/*! read_register_list function performs a read_word transaction per command code, chaining them with repeated starts.
+ * Only the last transaction ends with a Stop, so the whole list costs one bus acquisition.
+ * Function should return 0 on success and a non-0 error code on failure. The API functions will return your error code.
+ * A failed list is read again after each step of bus_recover() in turn.
+ */
+int read_register_list(uint8_t address,                     //!< IC's SMBus address (7-bit format).
+                       const uint8_t *command_codes,        //!< IC's Register addresses (SMBus command codes) to read, in order.
+                       uint16_t *data,                      //!< Memory location to store each whole register read from communication interface.
+                       uint8_t count,                       //!< Number of registers to read.
+                       struct port_configuration *pc        //!< Pointer to additional implementation-specific port configuration struct, if required.
+                      )
+{
+    (void)pc;                                   //Unneeded parameter in this implementation.
+    int result;
+    for (uint8_t tier = 0; (result = read_register_list_once(address, command_codes, data, count)) != SMBUS_OK and tier < RECOVERY_TIERS; tier++)
+        bus_recover(tier);
+    return result;
+}
+
+/*! Escalating response to a failed read, one tier per call, each counted and time stamped in bus_recovery.
+ * RECOVERY_RETRY does nothing; most PEC errors are a single corrupted bit and the next transaction succeeds.
+ * RECOVERY_CLOCKS is the standard SMBus bus clear: up to 9 clocks until a slave stuck mid-byte lets go of SDA, then a Stop.
+ * RECOVERY_RESET pulls D0 low, which resets the board and with it the LTC4162 port, then releases D0 should the reset not happen.
+ */
+void bus_recover(uint8_t tier)
+{
+    bus_recovery.count[tier]++;
+    bus_recovery.last_ms[tier] = millis();
+#ifdef LTC4162_INSTRUMENTATION
+    ltc4162_stats.recoveries++;
+#endif
+    if (tier == RECOVERY_CLOCKS)
+    {
+        pinMode(SDA, INPUT_PULLUP);
+        pinMode(SCL, OUTPUT);
+        for (int i = 0; i < 9 and digitalRead(SDA) == LOW; i++) // 100kHz clocks until the slave releases SDA
+        {
             digitalWrite(SCL, LOW);
+            delayMicroseconds(5);
             digitalWrite(SCL, HIGH);
-            digitalWrite(SCL, HIGH);
-            digitalWrite(SCL, HIGH);
+            delayMicroseconds(5);
         }
+        digitalWrite(SCL, LOW);                                 // Stop: SDA rises while SCL is high
+        pinMode(SDA, OUTPUT);
+        digitalWrite(SDA, LOW);
+        delayMicroseconds(5);
+        digitalWrite(SCL, HIGH);
+        delayMicroseconds(5);
+        pinMode(SDA, INPUT_PULLUP);
+        delayMicroseconds(5);
+        Wire.begin(SDA, SCL);                                   // Hand the pins back to the I2C port
+    }
+    else if (tier == RECOVERY_RESET)
+    {
         pinMode(D0, OUTPUT);                                    // Hammer the reset line low.
         digitalWrite(D0, LOW);                                  // This seems to clear up the I2C port every time.
+        delayMicroseconds(100);
+        pinMode(D0, INPUT_PULLUP);                              // Only reached if the reset did not take, leave the line as setup() had it.
+        LTC4162_cache_invalidate(&ltc4162);                     // Registers may be back at their power-on defaults.
+        Wire.begin(SDA, SCL);
     }
-    return 0;
 }
 
 /*! write_register function wraps C++ method LT_SMBus::writeWord.
  * Prototype: virtual void LT_SMBus::writeWord(uint8_t address, uint8_t command, uint16_t data);
  * Function should return 0 on success and a non-0 error code on failure. The API functions will return your error code.
+ * Appends the PEC byte, which the LTC4162 NACKs if the transfer was corrupted, and returns the Wire.endTransmission()
+ * result: SMBUS_NACK_ADDRESS if nothing answered, SMBUS_NACK_DATA if the command, data or PEC byte was refused.
  */
 int write_register(uint8_t address,                             //!< IC's SMBus address (7-bit format).
                    uint8_t command_code,                        //!< IC's Register address (SMBus command code) for write.
@@ -497,22 +836,156 @@ int write_register(uint8_t address,                             //!< IC's SMBus
     Wire.write(command_code);
     Wire.write(data & 0xff);
     Wire.write((data >> 8) & 0xff);
-    Wire.endTransmission(STOP);
-    return 0;
+    Wire.write(pec_write_word(address, command_code, data));
+    int result = Wire.endTransmission(STOP);
+#ifdef LTC4162_INSTRUMENTATION
+    if (result == SMBUS_NACK_ADDRESS || result == SMBUS_NACK_DATA)
+        ltc4162_stats.nacks++;
+#endif
+    return result;
+}
+
+uint32_t clock_ms()
+{
+    return millis();
 }
 
-int add_table_row(std::string column1_value, std::string column2_value, bool send_it)
+uint32_t clock_cycles()
+{
+    return ESP.getCycleCount();
+}
+
+int add_table_row(const char *column1_value, const char *column2_value, bool send_it)
 {
-    html = "";
-    html += "<tr><td>";
-    html += column1_value;
-    html +="</td><td>";
-    html += column2_value;
-    html +="</td></tr>";
     if (send_it)
-        client.print(html.c_str());
+    {
+        client.print(F("<tr><td>"));
+        client.print(column1_value);
+        client.print(F("</td><td>"));
+        client.print(column2_value);
+        client.print(F("</td></tr>"));
+    }
     return 0;
 }
 
+/*! Writes "0x", value in digits hex digits and a space. Returns a pointer to the terminating NUL. */
+char *history_hex(char *out, uint16_t value, uint8_t digits)
+{
+    *out++ = '0';
+    *out++ = 'x';
+    while (digits-- != 0)
+        *out++ = "0123456789ABCDEF"[(value >> (4 * digits)) & 0xF];
+    *out++ = ' ';
+    *out = '\0';
+    return out;
+}
 
+/*! Sends the history as plain text, oldest sample first, one line of integer milli-units per sample. */
+void print_history()
+{
+    LTC4162_history_iter_t iter;
+    const LTC4162_history_sample_t *sample;
+    char line[8 * LTC4162_FMT_SIZE + 32];
+    char *out;
+    client.print(F("HTTP/1.1 200\r\n"));
+    client.print(F("Content-Type: text/plain\r\n\r\n"));
+    client.print(F("time_s charger_state charge_status system_status vbat_mv vin_mv vout_mv ibat_ma iin_ma die_temp_mc thermistor_mc\n"));
+    for (LTC4162_history_iter(&history, &iter); (sample = LTC4162_history_next(&iter)) != NULL;)
+    {
+        out = LTC4162_fmt_fix(line, (int32_t)(iter.time_ms / 1000), 0, 0, " ");   // Whole seconds, samples are at least a second apart
+        out = history_hex(out, sample->charger_state, 4);
+        out = history_hex(out, LTC4162_HISTORY_CHARGE_STATUS(sample), 2);
+        out = history_hex(out, LTC4162_HISTORY_SYSTEM_STATUS(sample), 3);
+        out = LTC4162_fmt_fix(out, LTC4162_VBAT_FORMAT_I2FIX(sample->vbat) * cell_count, 0, 0, " ");
+        out = LTC4162_fmt_fix(out, LTC4162_VIN_FORMAT_I2FIX(sample->vin), 0, 0, " ");
+        out = LTC4162_fmt_fix(out, LTC4162_VOUT_FORMAT_I2FIX(sample->vout), 0, 0, " ");
+        out = LTC4162_fmt_fix(out, LTC4162_IBAT_FORMAT_I2FIX(sample->ibat), 0, 0, " ");
+        out = LTC4162_fmt_fix(out, LTC4162_IIN_FORMAT_I2FIX(sample->iin), 0, 0, " ");
+        out = LTC4162_fmt_fix(out, LTC4162_DIE_TEMP_FORMAT_I2FIX(sample->die_temp), 0, 0, " ");
+        LTC4162_fmt_fix(out, LTC4162_ntc_i2fix(&LTC4162_ntcs0402e3103flt, sample->thermistor_voltage), 0, 0, "\n");
+        client.print(line);
+        yield();                                                        // Hours of history, keep the WiFi stack fed
+    }
+}
 
+#ifdef LTC4162_INSTRUMENTATION
+uint32_t clock_us()
+{
+    return micros();
+}
+
+/*! Sends the SMBus statistics as plain text: a line per command code used, then the log2 microsecond latency histograms. */
+void print_stats()
+{
+    static const char *const kind_names[LTC4162_STATS_KINDS] = {"read", "write", "list"};
+    static const char *const tier_names[RECOVERY_TIERS] = {"retry", "clocks", "reset"};
+    char line[80];
+    client.print(F("HTTP/1.1 200\r\n"));
+    client.print(F("Content-Type: text/plain\r\n\r\n"));
+    client.print(F("command reads writes failures\n"));
+    for (int command_code = 0; command_code < LTC4162_STATS_COMMAND_CODES; command_code++)
+    {
+        if (!ltc4162_stats.reads[command_code] and !ltc4162_stats.writes[command_code])
+            continue;
+        sprintf(line, "0x%02X %lu %lu %lu\n", command_code, (unsigned long)ltc4162_stats.reads[command_code],
+                (unsigned long)ltc4162_stats.writes[command_code], (unsigned long)ltc4162_stats.failures[command_code]);
+        client.print(line);
+    }
+    client.print(F("\nlatency_us 1 2 4 8 16 32 64 128 256 512 1024 2048 4096 8192 16384 32768+ max\n"));
+    for (int kind = 0; kind < LTC4162_STATS_KINDS; kind++)
+    {
+        client.print(kind_names[kind]);
+        for (int bucket = 0; bucket < LTC4162_STATS_BUCKETS; bucket++)
+        {
+            client.print(F(" "));
+            client.print((unsigned long)ltc4162_stats.latency[kind][bucket]);
+        }
+        client.print(F(" "));
+        client.print((unsigned long)ltc4162_stats.latency_max[kind]);
+        client.print(F("\n"));
+    }
+    sprintf(line, "\npec_failures %lu\n", (unsigned long)ltc4162_stats.pec_failures);
+    client.print(line);
+    sprintf(line, "recoveries %lu\n", (unsigned long)ltc4162_stats.recoveries);
+    client.print(line);
+    sprintf(line, "nacks %lu\n", (unsigned long)ltc4162_stats.nacks);
+    client.print(line);
+    client.print(F("\nrecovery count last_ms\n"));
+    for (int tier = 0; tier < RECOVERY_TIERS; tier++)
+    {
+        sprintf(line, "%s %lu %lu\n", tier_names[tier], (unsigned long)bus_recovery.count[tier], (unsigned long)bus_recovery.last_ms[tier]);
+        client.print(line);
+    }
+    client.print(F("\n"));
+    client.print(F("task runs misses overruns max_cycles max_lateness_ms\n"));
+    for (int task = 0; task < TASK_COUNT; task++)
+    {
+        sprintf(line, "%s %lu %lu %lu %lu %lu\n", tasks[task].name, (unsigned long)tasks[task].runs, (unsigned long)tasks[task].misses,
+                (unsigned long)tasks[task].overruns, (unsigned long)tasks[task].max_cycles, (unsigned long)tasks[task].max_lateness_ms);
+        client.print(line);
+    }
+    client.print(F("\n"));
+    sprintf(line, "suppressed_writes %lu\n", (unsigned long)ltc4162_cache.suppressed_writes);
+    client.print(line);
+    sprintf(line, "queue_rejected %u\n", ltc4162_queue.rejected);
+    client.print(line);
+#ifdef LTC4162_EVENT_MODE
+    sprintf(line, "alerts_serviced %lu\n", (unsigned long)alert_stats.serviced);
+    client.print(line);
+    sprintf(line, "alerts_spurious %lu\n", (unsigned long)alert_stats.spurious);
+    client.print(line);
+    sprintf(line, "alert_events_dropped %u\n", events.dropped);
+    client.print(line);
+    sprintf(line, "alert_latency_max_us %lu\n", (unsigned long)(alert_stats.latency_max_cycles / (CYCLES_PER_MS / 1000)));
+    client.print(line);
+#endif
+#ifdef LTC4162_WINDOW_MODE
+    sprintf(line, "window_polls %lu\n", (unsigned long)window.polls);
+    client.print(line);
+    sprintf(line, "window_trips %lu\n", (unsigned long)window.trips);
+    client.print(line);
+    sprintf(line, "window_rereads %lu\n", (unsigned long)window.rereads);
+    client.print(line);
+#endif
+}
+#endif
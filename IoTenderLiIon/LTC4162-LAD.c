@@ -94,6 +94,104 @@ Generated on: 2018-03-09
  */
 
 #include "LTC4162-LAD.h"
+#include <string.h>
+
+/* Writable registers implemented in the LTC4162-L, one bit per command code from LTC4162_CACHE_FIRST_SUBADDR. */
+#define CACHE_BIT(command_code) ((uint64_t)1 << ((command_code) - LTC4162_CACHE_FIRST_SUBADDR))
+static const uint64_t cached_registers =
+  CACHE_BIT(LTC4162_VBAT_LO_ALERT_LIMIT_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_VBAT_HI_ALERT_LIMIT_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_VIN_LO_ALERT_LIMIT_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_VIN_HI_ALERT_LIMIT_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_VOUT_LO_ALERT_LIMIT_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_VOUT_HI_ALERT_LIMIT_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_IIN_HI_ALERT_LIMIT_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_IBAT_LO_ALERT_LIMIT_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_DIE_TEMP_HI_ALERT_LIMIT_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_BSR_HI_ALERT_LIMIT_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_THERMISTOR_VOLTAGE_HI_ALERT_LIMIT_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_THERMISTOR_VOLTAGE_LO_ALERT_LIMIT_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_EN_LIMIT_ALERTS_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_EN_CHARGER_STATE_ALERTS_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_EN_CHARGE_STATUS_ALERTS_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_THERMAL_REG_START_TEMP_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_THERMAL_REG_END_TEMP_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_CONFIG_BITS_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_IIN_LIMIT_TARGET_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_INPUT_UNDERVOLTAGE_SETTING_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_ARM_SHIP_MODE_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_CHARGE_CURRENT_SETTING_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_VCHARGE_SETTING_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_C_OVER_X_THRESHOLD_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_MAX_CV_TIME_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_MAX_CHARGE_TIME_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_JEITA_T1_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_JEITA_T2_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_JEITA_T3_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_JEITA_T4_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_JEITA_T5_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_JEITA_T6_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_VCHARGE_JEITA_6_5_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_VCHARGE_JEITA_4_3_2_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_ICHARGE_JEITA_6_5_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_ICHARGE_JEITA_4_3_2_REG_SUBADDR) |
+  CACHE_BIT(LTC4162_CHARGER_CONFIG_BITS_REG_SUBADDR);
+
+/* Registers gathered by LTC4162_read_telemetry and where each one lands in LTC4162_telemetry_t. */
+static const uint8_t telemetry_command_codes[] =
+{
+  LTC4162_TCHARGETIMER_REG_SUBADDR,
+  LTC4162_TCVTIMER_REG_SUBADDR,
+  LTC4162_CHARGER_STATE_REG_SUBADDR,
+  LTC4162_CHARGE_STATUS_REG_SUBADDR,
+  LTC4162_SYSTEM_STATUS_REG_SUBADDR,
+  LTC4162_VBAT_REG_SUBADDR,
+  LTC4162_VIN_REG_SUBADDR,
+  LTC4162_VOUT_REG_SUBADDR,
+  LTC4162_IBAT_REG_SUBADDR,
+  LTC4162_IIN_REG_SUBADDR,
+  LTC4162_DIE_TEMP_REG_SUBADDR,
+  LTC4162_THERMISTOR_VOLTAGE_REG_SUBADDR,
+  LTC4162_BSR_REG_SUBADDR,
+  LTC4162_JEITA_REGION_REG_SUBADDR,
+  LTC4162_CHEM_CELLS_REG_SUBADDR,
+  LTC4162_ICHARGE_DAC_REG_SUBADDR,
+  LTC4162_VCHARGE_DAC_REG_SUBADDR,
+  LTC4162_IIN_LIMIT_DAC_REG_SUBADDR,
+  LTC4162_VBAT_FILT_REG_SUBADDR,
+  LTC4162_BSR_CHARGE_CURRENT_REG_SUBADDR,
+  LTC4162_TELEMETRY_STATUS_REG_SUBADDR,
+  LTC4162_INPUT_UNDERVOLTAGE_DAC_REG_SUBADDR
+};
+static const uint8_t telemetry_offsets[] =
+{
+  offsetof(LTC4162_telemetry_t, tchargetimer),
+  offsetof(LTC4162_telemetry_t, tcvtimer),
+  offsetof(LTC4162_telemetry_t, charger_state),
+  offsetof(LTC4162_telemetry_t, charge_status),
+  offsetof(LTC4162_telemetry_t, system_status),
+  offsetof(LTC4162_telemetry_t, vbat),
+  offsetof(LTC4162_telemetry_t, vin),
+  offsetof(LTC4162_telemetry_t, vout),
+  offsetof(LTC4162_telemetry_t, ibat),
+  offsetof(LTC4162_telemetry_t, iin),
+  offsetof(LTC4162_telemetry_t, die_temp),
+  offsetof(LTC4162_telemetry_t, thermistor_voltage),
+  offsetof(LTC4162_telemetry_t, bsr),
+  offsetof(LTC4162_telemetry_t, jeita_region),
+  offsetof(LTC4162_telemetry_t, chem_cells),
+  offsetof(LTC4162_telemetry_t, icharge_dac),
+  offsetof(LTC4162_telemetry_t, vcharge_dac),
+  offsetof(LTC4162_telemetry_t, iin_limit_dac),
+  offsetof(LTC4162_telemetry_t, vbat_filt),
+  offsetof(LTC4162_telemetry_t, bsr_charge_current),
+  offsetof(LTC4162_telemetry_t, telemetry_status),
+  offsetof(LTC4162_telemetry_t, input_undervoltage_dac)
+};
+#define TELEMETRY_COUNT (sizeof(telemetry_command_codes) / sizeof(telemetry_command_codes[0]))
+
+/* Bits that the LTC4162 may clear on its own. A cached copy with any of these set is not trusted. */
+#define SELF_CLEARING_CONFIG_BITS (LTC4162_RUN_BSR_MASK)
 
 static inline uint8_t get_size(uint16_t registerinfo)
 {
@@ -116,11 +214,175 @@ static inline uint16_t get_mask(uint16_t registerinfo)
   }
   return (uint16_t)(((1 << size) - 1) << get_offset(registerinfo));
 }
+/* Same masking and shifting as the generated *_DECODE macros, driven by registerinfo instead of the field name. */
+static inline uint16_t decode_field(uint16_t registerinfo, uint16_t register_data)
+{
+  if (get_size(registerinfo) == LTC4162_WORD_SIZE) return register_data;
+  return (register_data & get_mask(registerinfo)) >> get_offset(registerinfo);
+}
+static inline uint64_t cache_bit(LTC4162_chip_cfg_t *chip, uint8_t command_code)
+{
+  if (chip->cache == NULL) return 0;
+  if (command_code < LTC4162_CACHE_FIRST_SUBADDR || command_code > LTC4162_CACHE_LAST_SUBADDR) return 0;
+  return CACHE_BIT(command_code) & cached_registers;
+}
+static inline uint16_t *cache_entry(LTC4162_chip_cfg_t *chip, uint8_t command_code)
+{
+  return &chip->cache->data[command_code - LTC4162_CACHE_FIRST_SUBADDR];
+}
+static inline uint16_t self_clearing_bits(uint8_t command_code)
+{
+  return command_code == LTC4162_CONFIG_BITS_REG_SUBADDR ? SELF_CLEARING_CONFIG_BITS : 0;
+}
+#ifdef LTC4162_INSTRUMENTATION
+static inline uint32_t stats_clock(LTC4162_chip_cfg_t *chip)
+{
+  return chip->stats == NULL ? 0 : chip->stats->clock_us();
+}
+static void stats_latency(LTC4162_stats_t *stats, uint8_t kind, uint32_t start)
+{
+  uint32_t elapsed = stats->clock_us() - start;
+  uint32_t remaining = elapsed;
+  uint8_t bucket = 0;
+  while (remaining > 1 && bucket < LTC4162_STATS_BUCKETS - 1)
+  {
+    remaining >>= 1;
+    bucket++;
+  }
+  stats->latency[kind][bucket]++;
+  if (elapsed > stats->latency_max[kind]) stats->latency_max[kind] = elapsed;
+}
+static void stats_count(LTC4162_stats_t *stats, uint32_t *counters, uint8_t command_code, int failure)
+{
+  if (command_code >= LTC4162_STATS_COMMAND_CODES) return;
+  counters[command_code]++;
+  if (failure) stats->failures[command_code]++;
+}
+#endif
+/* Calls to the user supplied SMBus functions, timed and counted when instrumentation is compiled in. */
+static int bus_read(LTC4162_chip_cfg_t *chip, uint8_t command_code, uint16_t *data)
+{
+#ifdef LTC4162_INSTRUMENTATION
+  uint32_t start = stats_clock(chip);
+  int failure = chip->read_register(chip->address,command_code,data,chip->port_configuration);
+  if (chip->stats != NULL)
+  {
+    stats_latency(chip->stats, LTC4162_STATS_READ, start);
+    stats_count(chip->stats, chip->stats->reads, command_code, failure);
+  }
+  return failure;
+#else
+  return chip->read_register(chip->address,command_code,data,chip->port_configuration);
+#endif
+}
+static int bus_write(LTC4162_chip_cfg_t *chip, uint8_t command_code, uint16_t data)
+{
+#ifdef LTC4162_INSTRUMENTATION
+  uint32_t start = stats_clock(chip);
+  int failure = chip->write_register(chip->address,command_code,data,chip->port_configuration);
+  if (chip->stats != NULL)
+  {
+    stats_latency(chip->stats, LTC4162_STATS_WRITE, start);
+    stats_count(chip->stats, chip->stats->writes, command_code, failure);
+  }
+  return failure;
+#else
+  return chip->write_register(chip->address,command_code,data,chip->port_configuration);
+#endif
+}
+static int bus_read_list(LTC4162_chip_cfg_t *chip, const uint8_t *command_codes, uint16_t *data, uint8_t count)
+{
+#ifdef LTC4162_INSTRUMENTATION
+  uint8_t i;
+  uint32_t start = stats_clock(chip);
+  int failure = chip->read_register_list(chip->address,command_codes,data,count,chip->port_configuration);
+  if (chip->stats != NULL)
+  {
+    stats_latency(chip->stats, LTC4162_STATS_LIST, start);
+    for (i = 0; i < count; i++) stats_count(chip->stats, chip->stats->reads, command_codes[i], failure);
+  }
+  return failure;
+#else
+  return chip->read_register_list(chip->address,command_codes,data,count,chip->port_configuration);
+#endif
+}
+static int read_word(LTC4162_chip_cfg_t *chip, uint8_t command_code, uint16_t *data)
+{
+  uint64_t bit = cache_bit(chip, command_code);
+  int failure = bus_read(chip,command_code,data);
+  if (bit)
+  {
+    if (failure) chip->cache->valid &= ~bit;
+    else
+    {
+      *cache_entry(chip, command_code) = *data;
+      chip->cache->valid |= bit;
+    }
+  }
+  return failure;
+}
+static int write_word(LTC4162_chip_cfg_t *chip, uint8_t command_code, uint16_t data)
+{
+  uint64_t bit = cache_bit(chip, command_code);
+  int failure = bus_write(chip,command_code,data);
+  if (bit)
+  {
+    if (failure) chip->cache->valid &= ~bit; // Unknown whether the write landed.
+    else
+    {
+      *cache_entry(chip, command_code) = data;
+      chip->cache->valid |= bit;
+    }
+  }
+  return failure;
+}
+/* Fetches the current register contents for a read-modify-write, from the cache when it can be trusted. */
+static int read_for_modify(LTC4162_chip_cfg_t *chip, uint8_t command_code, uint16_t *data)
+{
+  uint64_t bit = cache_bit(chip, command_code);
+  if (bit && (chip->cache->valid & bit) && !(*cache_entry(chip, command_code) & self_clearing_bits(command_code)))
+  {
+    *data = *cache_entry(chip, command_code);
+    return 0;
+  }
+  return read_word(chip, command_code, data);
+}
+/* True when the LTC4162 is known to already hold data, so writing it again would change nothing.
+   Self-clearing bits are commands rather than state, so a write setting one always goes out. */
+static int write_is_redundant(LTC4162_chip_cfg_t *chip, uint8_t command_code, uint16_t data)
+{
+  uint64_t bit = cache_bit(chip, command_code);
+  if (!bit || !(chip->cache->valid & bit)) return 0;
+  if (data & self_clearing_bits(command_code)) return 0;
+  return *cache_entry(chip, command_code) == data;
+}
 
 int LTC4162_write_register(LTC4162_chip_cfg_t *chip, uint16_t registerinfo, uint16_t data)
 {
-  int ret_val;
+  if (get_size(registerinfo) != LTC4162_WORD_SIZE)
+  {
+    assert(data < 1 << get_size(registerinfo)); // Disable runtime overflow checking by defining NDEBUG macro or setting -DNDEBUG CFLAGS option.
+    data = data << get_offset(registerinfo);
+  }
+  return LTC4162_write_bits(chip,get_command_code(registerinfo),get_mask(registerinfo),data);
+}
+
+int LTC4162_write_register_policy(LTC4162_chip_cfg_t *chip, uint16_t registerinfo, uint16_t data, LTC4162_write_policy_t policy)
+{
   uint8_t command_code = get_command_code(registerinfo);
+  uint16_t mask = get_mask(registerinfo) & ~self_clearing_bits(command_code);
+  uint16_t read_data;
+  int ret_val = LTC4162_write_register(chip,registerinfo,data);
+  if (ret_val || policy != LTC4162_WRITE_VERIFY_READBACK) return ret_val;
+  if (get_size(registerinfo) != LTC4162_WORD_SIZE) data = data << get_offset(registerinfo);
+  ret_val = read_word(chip,command_code,&read_data); // Straight from the part, leaving the cache holding what it really has.
+  if (ret_val) return ret_val;
+  return (read_data ^ data) & mask ? LTC4162_VERIFY_FAILED : 0;
+}
+
+int LTC4162_write_bits(LTC4162_chip_cfg_t *chip, uint8_t command_code, uint16_t mask, uint16_t data)
+{
+  int ret_val;
   /* It may be a good idea to acquire or assert some kind of
      exclusive lock on the i2c hardware here. How to do this
      is VERY dependent on your specific hardware.
@@ -142,17 +404,20 @@ int LTC4162_write_register(LTC4162_chip_cfg_t *chip, uint16_t registerinfo, uint
        goto RETURN;
      }
   */
-  if (get_size(registerinfo) != LTC4162_WORD_SIZE)
+  if (mask != UINT16_MAX)
   {
-    uint8_t offset = get_offset(registerinfo);
-    uint16_t mask = get_mask(registerinfo);
     uint16_t read_data;
-    ret_val = chip->read_register(chip->address,command_code,&read_data,chip->port_configuration);
+    ret_val = read_for_modify(chip,command_code,&read_data);
     if (ret_val) goto RETURN;
-    assert(data < 1 << get_size(registerinfo)); // Disable runtime overflow checking by defining NDEBUG macro or setting -DNDEBUG CFLAGS option.
-    data = (read_data & ~mask) | (data << offset);
+    data = (read_data & ~mask) | (data & mask);
   }
-  ret_val = chip->write_register(chip->address,command_code,data,chip->port_configuration);
+  if (write_is_redundant(chip,command_code,data))
+  {
+    chip->cache->suppressed_writes++;
+    ret_val = 0;
+    goto RETURN;
+  }
+  ret_val = write_word(chip,command_code,data);
   RETURN:
   /* If you added code to lock the i2c hardware at the beginning
      of this function, this is a good place to release that lock.
@@ -171,9 +436,131 @@ int LTC4162_write_register(LTC4162_chip_cfg_t *chip, uint16_t registerinfo, uint
 
 int LTC4162_read_register(LTC4162_chip_cfg_t *chip, uint16_t registerinfo, uint16_t *data)
 {
-  int failure = chip->read_register(chip->address,get_command_code(registerinfo),data,chip->port_configuration);
-  if (get_size(registerinfo) == LTC4162_WORD_SIZE) return failure;
-  *data &= get_mask(registerinfo);
-  *data = *data >> get_offset(registerinfo);
+  int failure = read_word(chip,get_command_code(registerinfo),data);
+  *data = decode_field(registerinfo, *data);
+  return failure;
+}
+
+int LTC4162_read_word(LTC4162_chip_cfg_t *chip, uint8_t command_code, uint16_t *data)
+{
+  return read_word(chip,command_code,data);
+}
+
+int LTC4162_read_fields(LTC4162_chip_cfg_t *chip, const uint16_t *registerinfo, uint16_t *data, uint8_t count)
+{
+  uint8_t i, j;
+  uint8_t command_code;
+  uint16_t register_data;
+  int failure;
+  for (i = 0; i < count; i++)
+  {
+    command_code = get_command_code(registerinfo[i]);
+    for (j = 0; j < i; j++)
+    {
+      if (get_command_code(registerinfo[j]) == command_code) break;
+    }
+    if (j < i) continue; // Already unpacked along with an earlier field from the same register.
+    failure = read_word(chip, command_code, &register_data);
+    if (failure) return failure;
+    for (j = i; j < count; j++)
+    {
+      if (get_command_code(registerinfo[j]) == command_code) data[j] = decode_field(registerinfo[j], register_data);
+    }
+  }
+  return 0;
+}
+
+int LTC4162_read_telemetry(LTC4162_chip_cfg_t *chip, LTC4162_telemetry_t *telemetry, uint32_t timestamp)
+{
+  uint16_t data[TELEMETRY_COUNT];
+  uint8_t i;
+  int failure = 0;
+  if (chip->read_register_list != NULL)
+  {
+    failure = bus_read_list(chip,telemetry_command_codes,data,TELEMETRY_COUNT);
+  }
+  else
+  {
+    for (i = 0; i < TELEMETRY_COUNT && !failure; i++)
+    {
+      failure = read_word(chip, telemetry_command_codes[i], &data[i]);
+    }
+  }
+  if (failure) return failure;
+  for (i = 0; i < TELEMETRY_COUNT; i++)
+  {
+    *(uint16_t *)((uint8_t *)telemetry + telemetry_offsets[i]) = data[i];
+  }
+  telemetry->timestamp = timestamp;
+  return 0;
+}
+
+int LTC4162_enable_alerts(LTC4162_chip_cfg_t *chip, const LTC4162_alerts_t *enable)
+{
+  int failure = LTC4162_write_bits(chip, LTC4162_EN_LIMIT_ALERTS_REG_SUBADDR, UINT16_MAX, enable->limit);
+  if (!failure) failure = LTC4162_write_bits(chip, LTC4162_EN_CHARGER_STATE_ALERTS_REG_SUBADDR, UINT16_MAX, enable->charger_state);
+  if (!failure) failure = LTC4162_write_bits(chip, LTC4162_EN_CHARGE_STATUS_ALERTS_REG_SUBADDR, UINT16_MAX, enable->charge_status);
+  return failure;
+}
+
+int LTC4162_read_alerts(LTC4162_chip_cfg_t *chip, LTC4162_alerts_t *alerts)
+{
+  static const uint8_t command_codes[] = {LTC4162_LIMIT_ALERTS_REG_SUBADDR, LTC4162_CHARGER_STATE_ALERTS_REG_SUBADDR, LTC4162_CHARGE_STATUS_ALERTS_REG_SUBADDR};
+  uint16_t data[3];
+  uint8_t i;
+  int failure = 0;
+  if (chip->read_register_list != NULL)
+  {
+    failure = bus_read_list(chip,command_codes,data,3);
+  }
+  else
+  {
+    for (i = 0; i < 3 && !failure; i++)
+    {
+      failure = read_word(chip, command_codes[i], &data[i]);
+    }
+  }
+  if (failure) return failure;
+  alerts->limit = data[0];
+  alerts->charger_state = data[1];
+  alerts->charge_status = data[2];
+  return 0;
+}
+
+int LTC4162_clear_alerts(LTC4162_chip_cfg_t *chip, const LTC4162_alerts_t *alerts)
+{
+  int failure = 0;
+  if (alerts->limit) failure = write_word(chip, LTC4162_LIMIT_ALERTS_REG_SUBADDR, (uint16_t)~alerts->limit);
+  if (!failure && alerts->charger_state) failure = write_word(chip, LTC4162_CHARGER_STATE_ALERTS_REG_SUBADDR, (uint16_t)~alerts->charger_state);
+  if (!failure && alerts->charge_status) failure = write_word(chip, LTC4162_CHARGE_STATUS_ALERTS_REG_SUBADDR, (uint16_t)~alerts->charge_status);
+  return failure;
+}
+
+void LTC4162_cache_invalidate(LTC4162_chip_cfg_t *chip)
+{
+  if (chip->cache != NULL) chip->cache->valid = 0;
+}
+
+int LTC4162_cache_resync(LTC4162_chip_cfg_t *chip)
+{
+  uint8_t command_code;
+  uint16_t data;
+  int failure = 0;
+  LTC4162_cache_invalidate(chip);
+  for (command_code = LTC4162_CACHE_FIRST_SUBADDR; command_code <= LTC4162_CACHE_LAST_SUBADDR; command_code++)
+  {
+    if (!cache_bit(chip, command_code)) continue;
+    failure = read_word(chip, command_code, &data);
+    if (failure) break;
+  }
   return failure;
 }
+
+#ifdef LTC4162_INSTRUMENTATION
+void LTC4162_stats_reset(LTC4162_stats_t *stats)
+{
+  uint32_t (*clock_us)(void) = stats->clock_us;
+  memset(stats, 0, sizeof(*stats));
+  stats->clock_us = clock_us;
+}
+#endif
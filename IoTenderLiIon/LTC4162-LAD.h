@@ -91,9 +91,13 @@ extern "C" {
 #include "LTC4162-LAD_reg_defs.h"
 #include "LTC4162-LAD_formats.h"
 #include <stdlib.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <assert.h>
 
+//Uncomment following line to record per command code SMBus transaction counts and latency histograms.
+//#define LTC4162_INSTRUMENTATION
+
   // Type declarations
 
   /*! Incomplete declaration of struct containing any hardware-specific information to pass to read and write functions
@@ -112,6 +116,75 @@ extern "C" {
                                      uint16_t *data,               //!< Pointer to data destination
                                      struct port_configuration *pc //!< Pointer to additional implementation-specific port configuration struct, if required.
                                     );
+  /*! Prototype of optional user supplied function performing several SMBus read_word transactions back to back.
+      Transactions should be chained with repeated starts and a single Stop after the last word.
+      Should return 0 on success and a non-0 error code on failure. */
+  typedef int (*smbus_read_register_list)(uint8_t address,              //!< Target IC's 7-bit SMBus address
+                                          const uint8_t *command_codes, //!< Command codes to be read from, in order
+                                          uint16_t *data,               //!< Pointer to data destination, one word per command code
+                                          uint8_t count,                //!< Number of registers to read
+                                          struct port_configuration *pc //!< Pointer to additional implementation-specific port configuration struct, if required.
+                                         );
+
+  /*! Range of command codes shadowed by the optional register cache. Covers the writable configuration registers. */
+#define LTC4162_CACHE_FIRST_SUBADDR 0x01
+#define LTC4162_CACHE_LAST_SUBADDR 0x2A
+#define LTC4162_CACHE_SIZE (LTC4162_CACHE_LAST_SUBADDR - LTC4162_CACHE_FIRST_SUBADDR + 1)
+
+  /*! Optional write-through shadow copy of the writable configuration registers.
+      With a cache attached, bit field writes merge into the cached register contents
+      instead of reading the register back first, so each costs one SMBus transaction,
+      and writes that would leave a register unchanged are skipped altogether.
+      Entries are filled by any whole register read or write and start out invalid. */
+  typedef struct
+  {
+    uint16_t data[LTC4162_CACHE_SIZE]; //!< Last known register contents, indexed by command code - LTC4162_CACHE_FIRST_SUBADDR
+    uint64_t valid;                    //!< Bit n is set when data[n] is known to match the LTC4162
+    uint32_t suppressed_writes;        //!< Number of writes skipped because the register already held the value
+  } LTC4162_cache_t;
+
+#ifdef LTC4162_INSTRUMENTATION
+  /*! Number of command codes with their own counters, 0x00 through LTC4162_STATS_COMMAND_CODES - 1. */
+#define LTC4162_STATS_COMMAND_CODES 0x4C
+  /*! Number of latency histogram buckets. Bucket n counts transactions taking 2^n to 2^(n+1)-1 microseconds, the last bucket everything longer. */
+#define LTC4162_STATS_BUCKETS 16
+  /*! Latency histogram selector. A register list read is timed once as a whole. */
+  enum {LTC4162_STATS_READ, LTC4162_STATS_WRITE, LTC4162_STATS_LIST, LTC4162_STATS_KINDS};
+
+  /*! SMBus access statistics, recorded around every call to the user supplied read and write functions.
+      Only compiled in when LTC4162_INSTRUMENTATION is defined. */
+  typedef struct
+  {
+    uint32_t (*clock_us)(void);                                      //!< User supplied free running microsecond clock, e.g. micros()
+    uint32_t reads[LTC4162_STATS_COMMAND_CODES];                     //!< Register reads per command code, including those within a list
+    uint32_t writes[LTC4162_STATS_COMMAND_CODES];                    //!< Register writes per command code
+    uint32_t failures[LTC4162_STATS_COMMAND_CODES];                  //!< Reads and writes per command code returning an error
+    uint32_t latency[LTC4162_STATS_KINDS][LTC4162_STATS_BUCKETS];    //!< Log2 microsecond latency histograms
+    uint32_t latency_max[LTC4162_STATS_KINDS];                       //!< Longest transaction seen, in microseconds
+    uint32_t pec_failures;                                           //!< Packet Error Check mismatches, counted by the user supplied read functions
+    uint32_t recoveries;                                             //!< Bus recovery attempts, counted by the user supplied read functions
+    uint32_t nacks;                                                  //!< Writes refused by the LTC4162 at the address, data or PEC byte, counted by the user supplied write function
+  } LTC4162_stats_t;
+#endif
+
+  /*! The three alert registers, or the three alert enable registers, each as a whole word. Use the _DECODE macros from
+      LTC4162-LAD_reg_defs.h on the members, or test them against the _MASK macros. */
+  typedef struct
+  {
+    uint16_t limit;          //!< LIMIT_ALERTS_REG, or EN_LIMIT_ALERTS_REG
+    uint16_t charger_state;  //!< CHARGER_STATE_ALERTS_REG, or EN_CHARGER_STATE_ALERTS_REG
+    uint16_t charge_status;  //!< CHARGE_STATUS_ALERTS_REG, or EN_CHARGE_STATUS_ALERTS_REG
+  } LTC4162_alerts_t;
+
+  /*! How much a successful write is trusted, chosen per call of @ref LTC4162_write_register_policy. */
+  typedef enum
+  {
+    LTC4162_WRITE_TRUST_PEC,      //!< A write the user supplied function reports as acknowledged is taken as landed. Sound when it sends a PEC byte, which the LTC4162 refuses if corrupted.
+    LTC4162_WRITE_VERIFY_READBACK //!< The register is also read back from the LTC4162 and compared under the bit field mask
+  } LTC4162_write_policy_t;
+
+  /*! Returned by @ref LTC4162_write_register_policy when the read back does not match what was written. */
+#define LTC4162_VERIFY_FAILED (-1)
 
   /*! Information required to access hardware SMBus port */
   typedef struct
@@ -120,19 +193,118 @@ extern "C" {
     smbus_read_register read_register;             //!< Pointer to a user supplied smbus_read_register function
     smbus_write_register write_register;           //!< Pointer to a user supplied smbus_write_register function
     struct port_configuration *port_configuration; //!< Pointer to additional implementation-specific port configuration struct, if required.
+    LTC4162_cache_t *cache;                        //!< Pointer to an optional shadow register cache. NULL reads back every register before a bit field write.
+    smbus_read_register_list read_register_list;   //!< Pointer to an optional user supplied smbus_read_register_list function. NULL issues one read_register per word.
+#ifdef LTC4162_INSTRUMENTATION
+    LTC4162_stats_t *stats;                        //!< Pointer to an optional statistics record. NULL records nothing.
+#endif
   } LTC4162_chip_cfg_t;
 
+  /*! Snapshot of the LTC4162 status and telemetry registers filled in by @ref LTC4162_read_telemetry.
+      Each member holds the whole register as read from the part. Use the _DECODE macros from
+      LTC4162-LAD_reg_defs.h to unpack bit fields and the LTC4162-LAD_formats.h macros to scale them. */
+  typedef struct
+  {
+    uint32_t timestamp;              //!< Caller supplied time at which the snapshot was taken, shared by every member
+    uint16_t tchargetimer;           //!< TCHARGETIMER_REG
+    uint16_t tcvtimer;               //!< TCVTIMER_REG
+    uint16_t charger_state;          //!< CHARGER_STATE_REG
+    uint16_t charge_status;          //!< CHARGE_STATUS_REG
+    uint16_t system_status;          //!< SYSTEM_STATUS_REG
+    uint16_t vbat;                   //!< VBAT_REG
+    uint16_t vin;                    //!< VIN_REG
+    uint16_t vout;                   //!< VOUT_REG
+    uint16_t ibat;                   //!< IBAT_REG
+    uint16_t iin;                    //!< IIN_REG
+    uint16_t die_temp;               //!< DIE_TEMP_REG
+    uint16_t thermistor_voltage;     //!< THERMISTOR_VOLTAGE_REG
+    uint16_t bsr;                    //!< BSR_REG
+    uint16_t jeita_region;           //!< JEITA_REGION_REG
+    uint16_t chem_cells;             //!< CHEM_CELLS_REG
+    uint16_t icharge_dac;            //!< ICHARGE_DAC_REG
+    uint16_t vcharge_dac;            //!< VCHARGE_DAC_REG
+    uint16_t iin_limit_dac;          //!< IIN_LIMIT_DAC_REG
+    uint16_t vbat_filt;              //!< VBAT_FILT_REG
+    uint16_t bsr_charge_current;     //!< BSR_CHARGE_CURRENT_REG
+    uint16_t telemetry_status;       //!< TELEMETRY_STATUS_REG
+    uint16_t input_undervoltage_dac; //!< INPUT_UNDERVOLTAGE_DAC_REG
+  } LTC4162_telemetry_t;
+
   // function declarations
   /*! Function to modify a bit field within a register while preserving the unaddressed bit fields. Returns 0 on success. */
   int LTC4162_write_register(LTC4162_chip_cfg_t *chip, //!< Pointer to chip configuration struct
                              uint16_t registerinfo,    //!< Bit field name from LTC4162_regdefs.h
                              uint16_t data             //!< Data to be written
                             );
+  /*! @ref LTC4162_write_register with a choice of how far to trust the write. With LTC4162_WRITE_VERIFY_READBACK the
+      register is read back from the LTC4162, even when the cache showed the write to be redundant, and compared under
+      the bit field mask, self-clearing bits excepted. Returns 0 on success, the user supplied function's error code on
+      bus failure or LTC4162_VERIFY_FAILED on mismatch. */
+  int LTC4162_write_register_policy(LTC4162_chip_cfg_t *chip,      //!< Pointer to chip configuration struct
+                                    uint16_t registerinfo,         //!< Bit field name from LTC4162_regdefs.h
+                                    uint16_t data,                 //!< Data to be written
+                                    LTC4162_write_policy_t policy  //!< Whether to read the register back
+                                   );
   /*! Retrieves a bit field data into *data. Right shifts the addressed portion down to the LSB position. Returns 0 on success. */
   int LTC4162_read_register(LTC4162_chip_cfg_t *chip, //!< Pointer to chip configuration struct
                             uint16_t registerinfo,    //!< Register name from LTC4162_regdefs.h
                             uint16_t *data            //!< Pointer to the data destination
                            );
+  /*! Modifies the bits selected by mask within the register at command_code, preserving the others.
+      data holds the new bits already shifted into place. A mask of 0xFFFF writes the whole register without reading it first.
+      This is the entry point for callers that have decoded registerinfo ahead of time, such as the C++ field types in LTC4162-LAD_fields.hpp. Returns 0 on success. */
+  int LTC4162_write_bits(LTC4162_chip_cfg_t *chip, //!< Pointer to chip configuration struct
+                         uint8_t command_code,     //!< Register address (SMBus command code)
+                         uint16_t mask,            //!< Bits to be modified
+                         uint16_t data             //!< New register contents under mask, already shifted into place
+                        );
+  /*! Retrieves the whole register at command_code into *data, keeping the shadow cache up to date. Returns 0 on success. */
+  int LTC4162_read_word(LTC4162_chip_cfg_t *chip, //!< Pointer to chip configuration struct
+                        uint8_t command_code,     //!< Register address (SMBus command code)
+                        uint16_t *data            //!< Pointer to the data destination
+                       );
+  /*! Retrieves several bit fields, reading each distinct register only once no matter how many of the requested fields it holds.
+      Fields are right shifted exactly as by @ref LTC4162_read_register, with data[n] receiving registerinfo[n]. Returns 0 on success. */
+  int LTC4162_read_fields(LTC4162_chip_cfg_t *chip,      //!< Pointer to chip configuration struct
+                          const uint16_t *registerinfo, //!< Array of bit field names from LTC4162_regdefs.h
+                          uint16_t *data,               //!< Array receiving one right shifted value per bit field
+                          uint8_t count                 //!< Number of entries in registerinfo and data
+                         );
+  /*! Reads the timers, charger state and status, system status and every telemetry register (0x3A-0x4B) in one pass.
+      Uses the chip's read_register_list function when supplied so the whole snapshot shares one Start and one Stop,
+      keeping the readings as close together in time as the bus allows. Returns 0 on success. */
+  int LTC4162_read_telemetry(LTC4162_chip_cfg_t *chip,       //!< Pointer to chip configuration struct
+                             LTC4162_telemetry_t *telemetry, //!< Pointer to the snapshot destination
+                             uint32_t timestamp              //!< Time stamp stored with the snapshot, e.g. millis()
+                            );
+  /*! Enables alerts by writing the three alert enable registers (0x0D-0x0F) whole. A set bit lets the matching alert
+      pull SMBALERT low. Returns 0 on success. */
+  int LTC4162_enable_alerts(LTC4162_chip_cfg_t *chip,        //!< Pointer to chip configuration struct
+                            const LTC4162_alerts_t *enable   //!< EN_LIMIT_ALERTS_REG, EN_CHARGER_STATE_ALERTS_REG and EN_CHARGE_STATUS_ALERTS_REG contents
+                           );
+  /*! Reads the three alert registers (0x36-0x38), in one pass when the chip has a read_register_list function.
+      Returns 0 on success. */
+  int LTC4162_read_alerts(LTC4162_chip_cfg_t *chip,   //!< Pointer to chip configuration struct
+                          LTC4162_alerts_t *alerts    //!< Pointer to the alert register destination
+                         );
+  /*! Clears the alerts set in alerts, as returned by @ref LTC4162_read_alerts, and no others: their bits are written 0
+      and every other bit 1, which the LTC4162 leaves alone, so an alert raised since the read is kept. A register with
+      nothing to clear is not written. SMBALERT is released once no enabled alert remains. Returns 0 on success. */
+  int LTC4162_clear_alerts(LTC4162_chip_cfg_t *chip,        //!< Pointer to chip configuration struct
+                           const LTC4162_alerts_t *alerts   //!< Alerts to clear
+                          );
+  /*! Marks every cached register stale so that the next bit field write to it reads the LTC4162 first.
+      Call after the LTC4162 has been reset or power cycled. Does nothing if no cache is attached. */
+  void LTC4162_cache_invalidate(LTC4162_chip_cfg_t *chip //!< Pointer to chip configuration struct
+                               );
+  /*! Reloads every cached register from the LTC4162. Returns 0 on success. */
+  int LTC4162_cache_resync(LTC4162_chip_cfg_t *chip //!< Pointer to chip configuration struct
+                          );
+#ifdef LTC4162_INSTRUMENTATION
+  /*! Clears every counter and histogram, keeping the clock function. */
+  void LTC4162_stats_reset(LTC4162_stats_t *stats //!< Pointer to statistics record
+                          );
+#endif
   /*! Functions to modify LTC4162 power-on defaults. */
   void configure_LTC4162_reg(LTC4162_chip_cfg_t *); //!< Modify settings in LTC4162_reg_config.c
   void configure_LTC4162_bf(LTC4162_chip_cfg_t *);  //!< Modify settings in LTC4162_bf_config.c
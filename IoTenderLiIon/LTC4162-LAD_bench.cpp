@@ -0,0 +1,326 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-L is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters including termination algorithms as
+well as numerous system status alerts. The LTC4162-L can charge Lithium-Ion cell
+stacks as high as eight cells with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-L is
+available in an I²C adjustable version as well as 4.0V, 4.1V and 4.2V fixed
+voltage versions all with and without MPPT enabled by default. The LTC4162-L is
+available in the 28-pin 4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date: 2018-03-09 17:54:10 -0500 (Fri, 09 Mar 2018) $
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-LAD
+ *  @brief LTC4162-LAD driver microbenchmarks for host builds.
+ *
+ *  Measures nanoseconds per operation for the register access functions against zero latency read and write
+ *  functions, the CRC-8, PEC and trace verification functions and every real/integer conversion macro in
+ *  LTC4162-LAD_formats.h, with the bulk conversions of a 256 sample log against the same macros, the fixed point
+ *  text formatter against snprintf, the scheduler, the solar probe, the history ring buffer and a quiet alert limit
+ *  window poll, and prints the results as JSON on stdout. Each figure is the fastest of several timed runs. Whether
+ *  the windows keep each reading within its hysteresis is checked by LTC4162-LAD_test.cpp.
+ *
+ *  Build and run from this folder, once as is, once with -DLTC4162_CRC_TABLE for the table driven CRC and
+ *  once each with -DLTC4162_CRC_SLICE=4 and -DLTC4162_CRC_SLICE=8 for the slicing tables:
+ *
+ *    g++ -O2 -o bench LTC4162-LAD_bench.cpp -x c LTC4162-LAD.c LTC4162-LAD_pec.c LTC4162-LAD_trace.c \
+ *        LTC4162-LAD_ntc.c LTC4162-LAD_bulk.c LTC4162-LAD_fmt.c LTC4162-LAD_sched.c LTC4162-LAD_solar.c \
+ *        LTC4162-LAD_history.c LTC4162-LAD_window.c
+ *    ./bench [iterations] > bench.json
+ *
+ *  Not compiled in the Arduino environment.
+ */
+
+#ifndef ARDUINO
+
+#include "LTC4162-LAD.h"
+#include "LTC4162-LAD_formats.h"
+#include "LTC4162-LAD_pec.h"
+#include "LTC4162-LAD_trace.h"
+#include "LTC4162-LAD_ntc.h"
+#include "LTC4162-LAD_bulk.h"
+#include "LTC4162-LAD_fmt.h"
+#include "LTC4162-LAD_sched.h"
+#include "LTC4162-LAD_solar.h"
+#include "LTC4162-LAD_history.h"
+#include "LTC4162-LAD_window.h"
+#include <chrono>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SAMPLES 256   // Inputs cycled through, so conversions cannot be folded to constants
+#define RUNS 5        // Timed runs per operation, the fastest is reported
+
+static uint16_t registers[256];
+static volatile uint32_t sink;          // Results land here so the work cannot be optimized away
+static uint16_t u_samples[SAMPLES];     // Unsigned register values for *_U2R
+static int16_t i_samples[SAMPLES];      // Signed register values for *_I2R
+static double real_samples[SAMPLES];    // Real values for *_R2U and *_R2I, filled per macro from its inverse
+static float bulk_out[SAMPLES];
+
+static int read_register(uint8_t address, uint8_t command_code, uint16_t *data, struct port_configuration *pc)
+{
+  (void)address;
+  (void)pc;
+  *data = registers[command_code];
+  return 0;
+}
+static int write_register(uint8_t address, uint8_t command_code, uint16_t data, struct port_configuration *pc)
+{
+  (void)address;
+  (void)pc;
+  registers[command_code] = data;
+  return 0;
+}
+
+static LTC4162_cache_t cache;
+static LTC4162_chip_cfg_t chip;
+static LTC4162_chip_cfg_t cached_chip;
+static uint8_t pec_prefix[256];
+static LTC4162_trace_frame_t frames[SAMPLES]; // Captured bus frames, half reads and half writes
+static bool first_result = true;
+
+/* Virtual clocks for the scheduler: a task run advances them by the task's cost. */
+static uint32_t virtual_ms, virtual_cycles;
+static uint32_t virtual_clock_ms(void) { return virtual_ms; }
+static uint32_t virtual_clock_cycles(void) { return virtual_cycles; }
+static void virtual_work(void *context)
+{
+  uint32_t cost_ms = *(const uint32_t *)context;
+  virtual_ms += cost_ms;
+  virtual_cycles += cost_ms * 80000;
+}
+static uint32_t costs_ms[] = {1, 8, 0, 0, 1, 0, 0, 150}; // As the sketch, plus the web page every two seconds
+#define VIRTUAL_TASK(name, cost, period_ms, deadline_ms, budget_ms) {name, virtual_work, &costs_ms[cost], period_ms, deadline_ms, budget_ms * 80000, 0, 0, 0, 0, 0, 0, 0, 0}
+static LTC4162_task_t schedule_tasks[] =
+{
+  VIRTUAL_TASK("power", 0, 100, 100, 2),
+  VIRTUAL_TASK("telemetry", 1, 1000, 500, 10),
+  VIRTUAL_TASK("history", 2, 10000, 1000, 1),
+  VIRTUAL_TASK("leds", 3, 100, 50, 1),
+  VIRTUAL_TASK("limits", 4, 5000, 1000, 2),
+  VIRTUAL_TASK("queue", 5, 20, 100, 5),
+  VIRTUAL_TASK("http", 6, 20, 100, 200),
+  VIRTUAL_TASK("page", 7, 2000, 2000, 200),
+};
+static LTC4162_sched_t schedule;
+static LTC4162_history_sample_t history_samples[1024];
+static LTC4162_history_t history;
+
+/* Times iterations calls of operation(i) and prints one JSON result object. */
+template <class Operation>
+static void bench(const char *name, unsigned long iterations, Operation operation)
+{
+  double best = 0;
+  for (int run = 0; run < RUNS; run++)
+  {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned long i = 0; i < iterations; i++) operation(i % SAMPLES);
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    double ns = elapsed.count() / iterations;
+    if (run == 0 || ns < best) best = ns;
+  }
+  printf("%s\n    {\"name\": \"%s\", \"ns_per_op\": %.3f}", first_result ? "" : ",", name, best);
+  first_result = false;
+}
+
+/* Benchmarks a real to register macro on real values made by its register to real inverse, then the inverse itself. */
+#define BENCH_FORMAT_U(R2U, U2R) \
+  for (int s = 0; s < SAMPLES; s++) real_samples[s] = U2R(u_samples[s]); \
+  bench(#R2U, iterations, [](int s) { sink += (uint16_t)R2U(real_samples[s]); }); \
+  bench(#U2R, iterations, [](int s) { sink += (uint32_t)(int32_t)U2R(u_samples[s]); });
+#define BENCH_FORMAT_I(R2I, I2R) \
+  for (int s = 0; s < SAMPLES; s++) real_samples[s] = I2R(i_samples[s]); \
+  bench(#R2I, iterations, [](int s) { sink += (int16_t)R2I(real_samples[s]); }); \
+  bench(#I2R, iterations, [](int s) { sink += (uint32_t)(int32_t)I2R(i_samples[s]); });
+
+/* Benchmarks a bulk channel over the sample log with the AVX2 kernels when supported and with the scalar loop, then
+   the macro alone over the same log. */
+#define BENCH_BULK(NAME, CHANNEL, I2R) \
+  for (int avx2 = 1; avx2 >= 0; avx2--) \
+  { \
+    if (LTC4162_bulk_avx2(avx2) != avx2) continue; \
+    bench(avx2 ? "LTC4162_bulk_convert/" NAME "_256_avx2" : "LTC4162_bulk_convert/" NAME "_256_scalar", iterations / SAMPLES, \
+          [](int s) { (void)s; LTC4162_bulk_convert(CHANNEL, i_samples, bulk_out, SAMPLES, 1); sink += (uint32_t)bulk_out[0]; }); \
+  } \
+  bench(#I2R "/256", iterations / SAMPLES, [](int s) { (void)s; for (int i = 0; i < SAMPLES; i++) bulk_out[i] = (float)I2R(i_samples[i]); sink += (uint32_t)bulk_out[0]; });
+
+/* Benchmarks a fixed point register to real macro. */
+#define BENCH_FIX(FIX) \
+  bench(#FIX, iterations, [](int s) { sink += (uint32_t)FIX(i_samples[s]); });
+
+/* Benchmarks a fixed point to register macro on fixed point values near the samples. */
+#define BENCH_FIX2(FIX2, FIX) \
+  bench(#FIX2, iterations, [](int s) { sink += (uint32_t)FIX2(FIX(i_samples[s]) + s); });
+
+int main(int argc, char *argv[])
+{
+  unsigned long iterations = argc > 1 ? strtoul(argv[1], NULL, 0) : 1000000;
+  for (int s = 0; s < SAMPLES; s++)
+  {
+    u_samples[s] = (uint16_t)s;
+    i_samples[s] = (int16_t)(s * 97 % 8192);
+    frames[s].address = LTC4162_ADDR_68;
+    frames[s].command_code = (uint8_t)s;
+    frames[s].data = (uint16_t)(s * 257);
+    frames[s].read = s & 1;
+    frames[s].pec = frames[s].read ? pec_read_word(LTC4162_ADDR_68, (uint8_t)s, frames[s].data) : pec_write_word(LTC4162_ADDR_68, (uint8_t)s, frames[s].data);
+  }
+  chip.address = LTC4162_ADDR_68;
+  chip.read_register = read_register;
+  chip.write_register = write_register;
+  cached_chip = chip;
+  cached_chip.cache = &cache;
+  pec_read_prefix_init(pec_prefix, LTC4162_ADDR_68);
+
+  printf("{\n  \"chip\": \"LTC4162-L\",\n");
+#ifdef LTC4162_CRC_TABLE
+  printf("  \"crc_table\": true,\n");
+#else
+  printf("  \"crc_table\": false,\n");
+#endif
+#ifdef LTC4162_CRC_SLICE
+  printf("  \"crc_slice\": %d,\n", LTC4162_CRC_SLICE);
+#endif
+  printf("  \"history_sample_bytes\": %u,\n", (unsigned)sizeof(LTC4162_history_sample_t));
+  printf("  \"compiler\": \"%s\",\n  \"iterations\": %lu,\n  \"results\": [", __VERSION__, iterations);
+
+  bench("LTC4162_read_register/word", iterations, [](int s) { uint16_t data; LTC4162_read_register(&chip, LTC4162_VBAT, &data); sink += data + s; });
+  bench("LTC4162_read_register/bit_field", iterations, [](int s) { uint16_t data; LTC4162_read_register(&chip, LTC4162_SUSPEND_CHARGER, &data); sink += data + s; });
+  bench("LTC4162_write_register/word", iterations, [](int s) { LTC4162_write_register(&chip, LTC4162_VBAT_LO_ALERT_LIMIT, (uint16_t)s); });
+  bench("LTC4162_write_register/bit_field", iterations, [](int s) { LTC4162_write_register(&chip, LTC4162_SUSPEND_CHARGER, s & 1); });
+  bench("LTC4162_write_register/bit_field_cached", iterations, [](int s) { LTC4162_write_register(&cached_chip, LTC4162_SUSPEND_CHARGER, s & 1); });
+  bench("LTC4162_write_register/bit_field_suppressed", iterations, [](int s) { (void)s; LTC4162_write_register(&cached_chip, LTC4162_SUSPEND_CHARGER, 1); });
+  bench("crc8", iterations, [](int s) { sink += crc8((uint8_t)s, (uint8_t)sink); });
+  bench("pec_read_word", iterations, [](int s) { sink += pec_read_word(LTC4162_ADDR_68, (uint8_t)s, u_samples[s]); });
+  bench("pec_write_word", iterations, [](int s) { sink += pec_write_word(LTC4162_ADDR_68, (uint8_t)s, u_samples[s]); });
+  bench("pec_read_word_prefixed", iterations, [](int s) { sink += pec_read_word_prefixed(pec_prefix, (uint8_t)s, u_samples[s]); });
+  bench("pec_block/64_bytes", iterations, [](int s) { sink += pec_block((const uint8_t *)u_samples + s, 64, 0); });
+  if (LTC4162_trace_clmul(1)) bench("LTC4162_trace_verify/256_frames_clmul", iterations / SAMPLES, [](int s) { (void)s; sink += LTC4162_trace_verify(frames, SAMPLES, NULL); });
+  LTC4162_trace_clmul(0);
+  bench("LTC4162_trace_verify/256_frames_pec_block", iterations / SAMPLES, [](int s) { (void)s; sink += LTC4162_trace_verify(frames, SAMPLES, NULL); });
+
+  BENCH_FORMAT_U(LTC4162_IINLIM_R2U, LTC4162_IINLIM_U2R)
+  BENCH_FORMAT_U(LTC4162_VCHARGE_LIION_R2U, LTC4162_VCHARGE_LIION_U2R)
+  BENCH_FORMAT_U(LTC4162_VIN_UVCL_R2U, LTC4162_VIN_UVCL_U2R)
+  BENCH_FORMAT_U(LTC4162_ICHARGE_R2U, LTC4162_ICHARGE_U2R)
+  BENCH_FORMAT_I(LTC4162_VBAT_FORMAT_R2I, LTC4162_VBAT_FORMAT_I2R)
+  BENCH_FORMAT_I(LTC4162_IBAT_FORMAT_R2I, LTC4162_IBAT_FORMAT_I2R)
+  BENCH_FORMAT_I(LTC4162_VOUT_FORMAT_R2I, LTC4162_VOUT_FORMAT_I2R)
+  BENCH_FORMAT_I(LTC4162_VIN_FORMAT_R2I, LTC4162_VIN_FORMAT_I2R)
+  BENCH_FORMAT_I(LTC4162_IIN_FORMAT_R2I, LTC4162_IIN_FORMAT_I2R)
+  BENCH_FORMAT_U(LTC4162_BSR_FORMAT_R2U, LTC4162_BSR_FORMAT_U2R)
+  BENCH_FORMAT_I(LTC4162_DIE_TEMP_FORMAT_R2I, LTC4162_DIE_TEMP_FORMAT_I2R)
+  BENCH_FORMAT_I(LTC4162_NTCS0402E3103FLT_R2I, LTC4162_NTCS0402E3103FLT_I2R)
+  BENCH_FIX(LTC4162_IINLIM_U2FIX)
+  BENCH_FIX(LTC4162_VCHARGE_LIION_U2FIX)
+  BENCH_FIX(LTC4162_VIN_UVCL_U2FIX)
+  BENCH_FIX(LTC4162_ICHARGE_U2FIX)
+  BENCH_FIX(LTC4162_VBAT_FORMAT_I2FIX)
+  BENCH_FIX(LTC4162_IBAT_FORMAT_I2FIX)
+  BENCH_FIX(LTC4162_VOUT_FORMAT_I2FIX)
+  BENCH_FIX(LTC4162_VIN_FORMAT_I2FIX)
+  BENCH_FIX(LTC4162_IIN_FORMAT_I2FIX)
+  BENCH_FIX(LTC4162_BSR_FORMAT_U2FIX)
+  BENCH_FIX(LTC4162_DIE_TEMP_FORMAT_I2FIX)
+  BENCH_FIX2(LTC4162_IINLIM_FIX2U, LTC4162_IINLIM_U2FIX)
+  BENCH_FIX2(LTC4162_VCHARGE_LIION_FIX2U, LTC4162_VCHARGE_LIION_U2FIX)
+  BENCH_FIX2(LTC4162_VIN_UVCL_FIX2U, LTC4162_VIN_UVCL_U2FIX)
+  BENCH_FIX2(LTC4162_ICHARGE_FIX2U, LTC4162_ICHARGE_U2FIX)
+  BENCH_FIX2(LTC4162_VBAT_FORMAT_FIX2I, LTC4162_VBAT_FORMAT_I2FIX)
+  BENCH_FIX2(LTC4162_IBAT_FORMAT_FIX2I, LTC4162_IBAT_FORMAT_I2FIX)
+  BENCH_FIX2(LTC4162_VOUT_FORMAT_FIX2I, LTC4162_VOUT_FORMAT_I2FIX)
+  BENCH_FIX2(LTC4162_VIN_FORMAT_FIX2I, LTC4162_VIN_FORMAT_I2FIX)
+  BENCH_FIX2(LTC4162_IIN_FORMAT_FIX2I, LTC4162_IIN_FORMAT_I2FIX)
+  BENCH_FIX2(LTC4162_BSR_FORMAT_FIX2U, LTC4162_BSR_FORMAT_U2FIX)
+  BENCH_FIX2(LTC4162_DIE_TEMP_FORMAT_FIX2I, LTC4162_DIE_TEMP_FORMAT_I2FIX)
+  bench("LTC4162_ntc_i2fix", iterations, [](int s) { sink += (uint32_t)LTC4162_ntc_i2fix(&LTC4162_ntcs0402e3103flt, (int16_t)(s * 97)); });
+  bench("LTC4162_ntc_fix2i", iterations, [](int s) { sink += (uint16_t)LTC4162_ntc_fix2i(&LTC4162_ntcs0402e3103flt, s * 700 - 40000); });
+  BENCH_BULK("ibat", LTC4162_BULK_IBAT, LTC4162_IBAT_FORMAT_I2R)
+  BENCH_BULK("thermistor", LTC4162_BULK_THERMISTOR, LTC4162_NTCS0402E3103FLT_I2R)
+  LTC4162_bulk_avx2(1);
+  bench("LTC4162_fmt_fix", iterations, [](int s) { char text[LTC4162_FMT_SIZE + 8]; sink += (uint32_t)(LTC4162_fmt_fix(text, i_samples[s] * 1009, 3, 3, "V") - text); });
+  bench("snprintf/%.3fV", iterations, [](int s) { char text[LTC4162_FMT_SIZE + 8]; sink += (uint32_t)snprintf(text, sizeof(text), "%.3fV", i_samples[s] * 1.009); });
+  bench("LTC4162_fmt_duration", iterations, [](int s) { char text[LTC4162_FMT_SIZE]; sink += (uint32_t)(LTC4162_fmt_duration(text, (uint32_t)s * 1031) - text); });
+  bench("snprintf/%dh %dm %ds", iterations, [](int s) { char text[LTC4162_FMT_SIZE]; uint32_t t = (uint32_t)s * 1031; sink += (uint32_t)snprintf(text, sizeof(text), "%dh %dm %ds", (int)(t / 3600), (int)(t % 3600 / 60), (int)(t % 60)); });
+  LTC4162_sched_init(&schedule, schedule_tasks, sizeof(schedule_tasks) / sizeof(schedule_tasks[0]), virtual_clock_ms, virtual_clock_cycles);
+  bench("LTC4162_sched_run/idle_pass", iterations, [](int s) { (void)s; sink += LTC4162_sched_run(&schedule) + LTC4162_sched_idle_ms(&schedule); });
+  {
+    LTC4162_solar_t solar;
+    LTC4162_solar_init(&solar, 98);
+    LTC4162_solar_start(&solar, &chip, 0);
+    bench("LTC4162_solar_step/waiting", iterations, [&solar](int s) { sink += LTC4162_solar_step(&solar, &chip, (uint32_t)s % LTC4162_SOLAR_OPEN_CIRCUIT_MS, 1); });
+  }
+  LTC4162_history_init(&history, history_samples, sizeof(history_samples) / sizeof(history_samples[0]));
+  bench("LTC4162_history_append", iterations, [](int s) { static LTC4162_telemetry_t snapshot; snapshot.timestamp += 10000; snapshot.vbat = u_samples[s]; LTC4162_history_append(&history, &snapshot); sink += history.head; });
+  bench("LTC4162_history_next", iterations, [](int s) { static LTC4162_history_iter_t iter; const LTC4162_history_sample_t *sample = LTC4162_history_next(&iter); (void)s; if (sample) sink += (uint16_t)sample->vbat + iter.time_ms; else LTC4162_history_iter(&history, &iter); });
+  {
+    static const uint16_t hysteresis[LTC4162_WINDOW_CHANNELS] = {50, 60, 60, 130, 130, 45, 50, 200};   // Close to the sketch's, in A/D codes
+    LTC4162_window_t window;
+    LTC4162_telemetry_t snapshot = {};
+    LTC4162_cache_invalidate(&cached_chip);   // The benches above wrote behind its back
+    LTC4162_window_init(&window, hysteresis);
+    LTC4162_window_arm(&window, &cached_chip, &snapshot);
+    registers[LTC4162_LIMIT_ALERTS_REG_SUBADDR] = 0;
+    bench("LTC4162_window_poll/quiet", iterations, [&window, &snapshot](int s) { sink += LTC4162_window_poll(&window, &cached_chip, &snapshot, (uint32_t)s) + window.polls; });
+  }
+  printf("\n  ]\n}\n");
+  return 0;
+}
+
+#endif /* ARDUINO */
@@ -0,0 +1,121 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-L is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters including termination algorithms as
+well as numerous system status alerts. The LTC4162-L can charge Lithium-Ion cell
+stacks as high as eight cells with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-L is
+available in an I²C adjustable version as well as 4.0V, 4.1V and 4.2V fixed
+voltage versions all with and without MPPT enabled by default. The LTC4162-L is
+available in the 28-pin 4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date: 2018-03-09 17:54:10 -0500 (Fri, 09 Mar 2018) $
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-LAD
+ *  @brief LTC4162-LAD bulk conversion of logged telemetry for host tools.
+ *
+ *  Converts whole arrays of raw register readings for one channel to volts, amperes, °C or ohms in a
+ *  single call, for analysis of large telemetry logs. Results match the LTC4162-LAD_formats.h macros
+ *  to single precision. On x86 processors with AVX2 eight samples are converted per step, chosen at
+ *  run time; otherwise, or when disabled with @ref LTC4162_bulk_avx2, a scalar loop does the same
+ *  arithmetic. The thermistor channel follows the piecewise LTC4162_NTCS0402E3103FLT_I2R curve.
+ *
+ *  Host tools only, never compiled in the Arduino environment.
+ */
+
+#ifndef LTC4162_BULK_H_
+#define LTC4162_BULK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+  /*! Telemetry channels and the conversion applied to each. */
+  typedef enum
+  {
+    LTC4162_BULK_VBAT,       //!< LTC4162_VBAT_FORMAT_I2R, times the battery multiplier cell_count
+    LTC4162_BULK_IBAT,       //!< LTC4162_IBAT_FORMAT_I2R
+    LTC4162_BULK_VOUT,       //!< LTC4162_VOUT_FORMAT_I2R
+    LTC4162_BULK_VIN,        //!< LTC4162_VIN_FORMAT_I2R
+    LTC4162_BULK_IIN,        //!< LTC4162_IIN_FORMAT_I2R
+    LTC4162_BULK_DIE_TEMP,   //!< LTC4162_DIE_TEMP_FORMAT_I2R
+    LTC4162_BULK_THERMISTOR, //!< LTC4162_NTCS0402E3103FLT_I2R
+    LTC4162_BULK_BSR,        //!< LTC4162_BSR_FORMAT_U2R of the unsigned reading, times the battery multiplier cell_count
+    LTC4162_BULK_CHANNELS    //!< Number of channels
+  } LTC4162_bulk_channel_t;
+
+  /*! Converts count raw readings of one channel into out. cell_count is ignored by channels that do not scale with it. */
+  void LTC4162_bulk_convert(LTC4162_bulk_channel_t channel, //!< Channel the readings belong to
+                            const int16_t *raw,             //!< Register readings as logged
+                            float *out,                     //!< Destination for count converted values
+                            size_t count,                   //!< Number of readings
+                            uint16_t cell_count             //!< CELL_COUNT bit field logged with the readings
+                           );
+
+  /*! Enables (1) or disables (0) the AVX2 kernels. Returns 1 if they are in use afterwards, which requires processor
+   *  support. They are enabled by default when supported.
+   */
+  int LTC4162_bulk_avx2(int enable //!< 1 to use AVX2 when available, 0 to force the scalar loops
+                       );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LTC4162_BULK_H_ */
@@ -0,0 +1,141 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-L is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters including termination algorithms as
+well as numerous system status alerts. The LTC4162-L can charge Lithium-Ion cell
+stacks as high as eight cells with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-L is
+available in an I²C adjustable version as well as 4.0V, 4.1V and 4.2V fixed
+voltage versions all with and without MPPT enabled by default. The LTC4162-L is
+available in the 28-pin 4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date: 2018-03-09 17:54:10 -0500 (Fri, 09 Mar 2018) $
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-LAD
+ *  @brief LTC4162-LAD lock-free single producer, single consumer event queue.
+ *
+ *  Carries events from an interrupt handler, such as the SMBALERT pin's, to the main loop without disabling
+ *  interrupts. The producer only ever advances head and the consumer only ever advances tail, and each publishes its
+ *  index after the slot it covers has been written or read, so neither side can see a half written event. With one
+ *  producer and one consumer no other synchronization is needed.
+ *
+ *  @ref LTC4162_event_post is defined inline here so that it is compiled into the interrupt handler itself; on the
+ *  ESP8266 an interrupt handler must not call into flash.
+ */
+
+#ifndef LTC4162_EVENT_H_
+#define LTC4162_EVENT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define LTC4162_EVENT_QUEUE_SIZE 16   //!< Slots, a power of two no larger than 128 so the 8 bit indexes wrap cleanly
+
+  /*! One event. */
+  typedef struct
+  {
+    uint8_t type;      //!< Application defined event type
+    uint16_t data;     //!< Application defined data
+    uint32_t stamp;    //!< Producer's time stamp, e.g. a cycle count
+  } LTC4162_event_t;
+
+  /*! Bounded queue of events. */
+  typedef struct
+  {
+    LTC4162_event_t events[LTC4162_EVENT_QUEUE_SIZE];  //!< Slots, indexed modulo LTC4162_EVENT_QUEUE_SIZE
+    volatile uint8_t head;                             //!< Events posted, advanced only by the producer
+    volatile uint8_t tail;                             //!< Events taken, advanced only by the consumer
+    volatile uint16_t dropped;                         //!< Posts refused because the queue was full, counted by the producer
+  } LTC4162_event_queue_t;
+
+  /*! Prepares an empty queue. Call before the producer can post. */
+  void LTC4162_event_init(LTC4162_event_queue_t *queue //!< Pointer to the queue to initialize
+                         );
+  /*! Producer side: appends an event. Safe from an interrupt handler. Returns 0 on success, non-zero if the queue is full. */
+  static inline int LTC4162_event_post(LTC4162_event_queue_t *queue, //!< Pointer to the queue
+                                       uint8_t type,                 //!< Event type
+                                       uint16_t data,                //!< Event data
+                                       uint32_t stamp                //!< Time stamp
+                                      )
+  {
+    uint8_t head = queue->head;
+    LTC4162_event_t *event;
+    if ((uint8_t)(head - queue->tail) == LTC4162_EVENT_QUEUE_SIZE)
+    {
+      queue->dropped++;
+      return 1;
+    }
+    event = &queue->events[head & (LTC4162_EVENT_QUEUE_SIZE - 1)];
+    event->type = type;
+    event->data = data;
+    event->stamp = stamp;
+    __sync_synchronize();   // The slot is written before head makes it visible
+    queue->head = (uint8_t)(head + 1);
+    return 0;
+  }
+  /*! Consumer side: removes the oldest event into *event. Returns non-zero if there was one, 0 if the queue was empty. */
+  int LTC4162_event_take(LTC4162_event_queue_t *queue, //!< Pointer to the queue
+                         LTC4162_event_t *event        //!< Pointer to the event destination
+                        );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LTC4162_EVENT_H_ */
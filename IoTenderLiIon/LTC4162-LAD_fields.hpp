@@ -0,0 +1,347 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-L is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters including termination algorithms as
+well as numerous system status alerts. The LTC4162-L can charge Lithium-Ion cell
+stacks as high as eight cells with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-L is
+available in an I²C adjustable version as well as 4.0V, 4.1V and 4.2V fixed
+voltage versions all with and without MPPT enabled by default. The LTC4162-L is
+available in the 28-pin 4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date: 2018-03-09 17:54:10 -0500 (Fri, 09 Mar 2018) $
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+
+/*! @file
+ *  @ingroup LTC4162-LAD
+ *  @brief LTC4162-LAD compile-time register and bit field types for C++.
+ *
+ *  Each register and bit field from LTC4162-LAD_reg_defs.h is available here as a type,
+ *  LTC4162::Field<command_code, offset, size>, named after the C macro without the LTC4162_ prefix.
+ *  Masks, shifts, word versus bit field dispatch and value range checks are resolved by the compiler
+ *  instead of unpacking a registerinfo word at runtime, and constant out of range values fail to compile.
+ *
+ *  Accesses go through @ref LTC4162_read_word and @ref LTC4162_write_bits, so they share the
+ *  shadow register cache with the C API and the two can be mixed freely.
+ *
+ *  LTC4162::read<LTC4162::SUSPEND_CHARGER>(&chip, &data);
+ *  LTC4162::write<LTC4162::TELEMETRY_SPEED, LTC4162_TELEMETRY_SPEED_ENUM_TEL_HIGH_SPEED>(&chip);
+ */
+
+#ifndef LTC4162_FIELDS_HPP_
+#define LTC4162_FIELDS_HPP_
+
+#include "LTC4162-LAD.h"
+
+namespace LTC4162
+{
+  /*! A register (size LTC4162_WORD_SIZE) or a bit field within one. */
+  template <uint8_t CommandCode, uint8_t Offset, uint8_t Size>
+  struct Field
+  {
+    static_assert(Size >= 1 && Size <= LTC4162_WORD_SIZE, "Bit field size must be 1 to 16 bits");
+    static_assert(Offset + Size <= LTC4162_WORD_SIZE, "Bit field must fit within its 16 bit register");
+
+    static const uint8_t command_code = CommandCode;
+    static const uint8_t offset = Offset;
+    static const uint8_t size = Size;
+    static const bool is_word = Size == LTC4162_WORD_SIZE;
+    static const uint16_t max = (uint16_t)((1UL << Size) - 1);
+    static const uint16_t mask = (uint16_t)(max << Offset);
+    static const uint16_t registerinfo = Offset << 12 | (Size - 1) << 8 | CommandCode; //!< Same encoding as the C macros, for mixing with the C API
+
+    /*! Equivalent to the field's _DECODE macro. */
+    static constexpr uint16_t decode(uint16_t register_data)
+    {
+      return is_word ? register_data : (uint16_t)((register_data & mask) >> Offset);
+    }
+    /*! Shifts value into place within the register. */
+    static constexpr uint16_t encode(uint16_t value)
+    {
+      return (uint16_t)(value << Offset);
+    }
+  };
+
+  /*! Retrieves the field into *data, right justified. Returns 0 on success. */
+  template <class F>
+  inline int read(LTC4162_chip_cfg_t *chip, uint16_t *data)
+  {
+    int failure = LTC4162_read_word(chip, F::command_code, data);
+    *data = F::decode(*data);
+    return failure;
+  }
+
+  /*! Writes a constant to the field, preserving the rest of the register. Out of range values fail to compile. Returns 0 on success. */
+  template <class F, uint16_t Value>
+  inline int write(LTC4162_chip_cfg_t *chip)
+  {
+    static_assert(Value <= F::max, "Value does not fit in bit field");
+    return LTC4162_write_bits(chip, F::command_code, F::mask, F::encode(Value));
+  }
+
+  /*! Writes a runtime value to the field, preserving the rest of the register. Returns 0 on success. */
+  template <class F>
+  inline int write(LTC4162_chip_cfg_t *chip, uint16_t value)
+  {
+    assert(value <= F::max); // Disable runtime overflow checking by defining NDEBUG macro or setting -DNDEBUG CFLAGS option.
+    return LTC4162_write_bits(chip, F::command_code, F::mask, F::encode(value));
+  }
+
+  /*! @name Registers */
+  typedef Field<LTC4162_VBAT_LO_ALERT_LIMIT_REG_SUBADDR, 0, LTC4162_WORD_SIZE> VBAT_LO_ALERT_LIMIT_REG;
+  typedef Field<LTC4162_VBAT_HI_ALERT_LIMIT_REG_SUBADDR, 0, LTC4162_WORD_SIZE> VBAT_HI_ALERT_LIMIT_REG;
+  typedef Field<LTC4162_VIN_LO_ALERT_LIMIT_REG_SUBADDR, 0, LTC4162_WORD_SIZE> VIN_LO_ALERT_LIMIT_REG;
+  typedef Field<LTC4162_VIN_HI_ALERT_LIMIT_REG_SUBADDR, 0, LTC4162_WORD_SIZE> VIN_HI_ALERT_LIMIT_REG;
+  typedef Field<LTC4162_VOUT_LO_ALERT_LIMIT_REG_SUBADDR, 0, LTC4162_WORD_SIZE> VOUT_LO_ALERT_LIMIT_REG;
+  typedef Field<LTC4162_VOUT_HI_ALERT_LIMIT_REG_SUBADDR, 0, LTC4162_WORD_SIZE> VOUT_HI_ALERT_LIMIT_REG;
+  typedef Field<LTC4162_IIN_HI_ALERT_LIMIT_REG_SUBADDR, 0, LTC4162_WORD_SIZE> IIN_HI_ALERT_LIMIT_REG;
+  typedef Field<LTC4162_IBAT_LO_ALERT_LIMIT_REG_SUBADDR, 0, LTC4162_WORD_SIZE> IBAT_LO_ALERT_LIMIT_REG;
+  typedef Field<LTC4162_DIE_TEMP_HI_ALERT_LIMIT_REG_SUBADDR, 0, LTC4162_WORD_SIZE> DIE_TEMP_HI_ALERT_LIMIT_REG;
+  typedef Field<LTC4162_BSR_HI_ALERT_LIMIT_REG_SUBADDR, 0, LTC4162_WORD_SIZE> BSR_HI_ALERT_LIMIT_REG;
+  typedef Field<LTC4162_THERMISTOR_VOLTAGE_HI_ALERT_LIMIT_REG_SUBADDR, 0, LTC4162_WORD_SIZE> THERMISTOR_VOLTAGE_HI_ALERT_LIMIT_REG;
+  typedef Field<LTC4162_THERMISTOR_VOLTAGE_LO_ALERT_LIMIT_REG_SUBADDR, 0, LTC4162_WORD_SIZE> THERMISTOR_VOLTAGE_LO_ALERT_LIMIT_REG;
+  typedef Field<LTC4162_EN_LIMIT_ALERTS_REG_SUBADDR, 0, LTC4162_WORD_SIZE> EN_LIMIT_ALERTS_REG;
+  typedef Field<LTC4162_EN_CHARGER_STATE_ALERTS_REG_SUBADDR, 0, LTC4162_WORD_SIZE> EN_CHARGER_STATE_ALERTS_REG;
+  typedef Field<LTC4162_EN_CHARGE_STATUS_ALERTS_REG_SUBADDR, 0, LTC4162_WORD_SIZE> EN_CHARGE_STATUS_ALERTS_REG;
+  typedef Field<LTC4162_THERMAL_REG_START_TEMP_REG_SUBADDR, 0, LTC4162_WORD_SIZE> THERMAL_REG_START_TEMP_REG;
+  typedef Field<LTC4162_THERMAL_REG_END_TEMP_REG_SUBADDR, 0, LTC4162_WORD_SIZE> THERMAL_REG_END_TEMP_REG;
+  typedef Field<LTC4162_CONFIG_BITS_REG_SUBADDR, 0, LTC4162_WORD_SIZE> CONFIG_BITS_REG;
+  typedef Field<LTC4162_IIN_LIMIT_TARGET_REG_SUBADDR, 0, LTC4162_WORD_SIZE> IIN_LIMIT_TARGET_REG;
+  typedef Field<LTC4162_INPUT_UNDERVOLTAGE_SETTING_REG_SUBADDR, 0, LTC4162_WORD_SIZE> INPUT_UNDERVOLTAGE_SETTING_REG;
+  typedef Field<LTC4162_ARM_SHIP_MODE_REG_SUBADDR, 0, LTC4162_WORD_SIZE> ARM_SHIP_MODE_REG;
+  typedef Field<LTC4162_CHARGE_CURRENT_SETTING_REG_SUBADDR, 0, LTC4162_WORD_SIZE> CHARGE_CURRENT_SETTING_REG;
+  typedef Field<LTC4162_VCHARGE_SETTING_REG_SUBADDR, 0, LTC4162_WORD_SIZE> VCHARGE_SETTING_REG;
+  typedef Field<LTC4162_C_OVER_X_THRESHOLD_REG_SUBADDR, 0, LTC4162_WORD_SIZE> C_OVER_X_THRESHOLD_REG;
+  typedef Field<LTC4162_MAX_CV_TIME_REG_SUBADDR, 0, LTC4162_WORD_SIZE> MAX_CV_TIME_REG;
+  typedef Field<LTC4162_MAX_CHARGE_TIME_REG_SUBADDR, 0, LTC4162_WORD_SIZE> MAX_CHARGE_TIME_REG;
+  typedef Field<LTC4162_JEITA_T1_REG_SUBADDR, 0, LTC4162_WORD_SIZE> JEITA_T1_REG;
+  typedef Field<LTC4162_JEITA_T2_REG_SUBADDR, 0, LTC4162_WORD_SIZE> JEITA_T2_REG;
+  typedef Field<LTC4162_JEITA_T3_REG_SUBADDR, 0, LTC4162_WORD_SIZE> JEITA_T3_REG;
+  typedef Field<LTC4162_JEITA_T4_REG_SUBADDR, 0, LTC4162_WORD_SIZE> JEITA_T4_REG;
+  typedef Field<LTC4162_JEITA_T5_REG_SUBADDR, 0, LTC4162_WORD_SIZE> JEITA_T5_REG;
+  typedef Field<LTC4162_JEITA_T6_REG_SUBADDR, 0, LTC4162_WORD_SIZE> JEITA_T6_REG;
+  typedef Field<LTC4162_VCHARGE_JEITA_6_5_REG_SUBADDR, 0, LTC4162_WORD_SIZE> VCHARGE_JEITA_6_5_REG;
+  typedef Field<LTC4162_VCHARGE_JEITA_4_3_2_REG_SUBADDR, 0, LTC4162_WORD_SIZE> VCHARGE_JEITA_4_3_2_REG;
+  typedef Field<LTC4162_ICHARGE_JEITA_6_5_REG_SUBADDR, 0, LTC4162_WORD_SIZE> ICHARGE_JEITA_6_5_REG;
+  typedef Field<LTC4162_ICHARGE_JEITA_4_3_2_REG_SUBADDR, 0, LTC4162_WORD_SIZE> ICHARGE_JEITA_4_3_2_REG;
+  typedef Field<LTC4162_CHARGER_CONFIG_BITS_REG_SUBADDR, 0, LTC4162_WORD_SIZE> CHARGER_CONFIG_BITS_REG;
+  typedef Field<LTC4162_TCHARGETIMER_REG_SUBADDR, 0, LTC4162_WORD_SIZE> TCHARGETIMER_REG;
+  typedef Field<LTC4162_TCVTIMER_REG_SUBADDR, 0, LTC4162_WORD_SIZE> TCVTIMER_REG;
+  typedef Field<LTC4162_CHARGER_STATE_REG_SUBADDR, 0, LTC4162_WORD_SIZE> CHARGER_STATE_REG;
+  typedef Field<LTC4162_CHARGE_STATUS_REG_SUBADDR, 0, LTC4162_WORD_SIZE> CHARGE_STATUS_REG;
+  typedef Field<LTC4162_LIMIT_ALERTS_REG_SUBADDR, 0, LTC4162_WORD_SIZE> LIMIT_ALERTS_REG;
+  typedef Field<LTC4162_CHARGER_STATE_ALERTS_REG_SUBADDR, 0, LTC4162_WORD_SIZE> CHARGER_STATE_ALERTS_REG;
+  typedef Field<LTC4162_CHARGE_STATUS_ALERTS_REG_SUBADDR, 0, LTC4162_WORD_SIZE> CHARGE_STATUS_ALERTS_REG;
+  typedef Field<LTC4162_SYSTEM_STATUS_REG_SUBADDR, 0, LTC4162_WORD_SIZE> SYSTEM_STATUS_REG;
+  typedef Field<LTC4162_VBAT_REG_SUBADDR, 0, LTC4162_WORD_SIZE> VBAT_REG;
+  typedef Field<LTC4162_VIN_REG_SUBADDR, 0, LTC4162_WORD_SIZE> VIN_REG;
+  typedef Field<LTC4162_VOUT_REG_SUBADDR, 0, LTC4162_WORD_SIZE> VOUT_REG;
+  typedef Field<LTC4162_IBAT_REG_SUBADDR, 0, LTC4162_WORD_SIZE> IBAT_REG;
+  typedef Field<LTC4162_IIN_REG_SUBADDR, 0, LTC4162_WORD_SIZE> IIN_REG;
+  typedef Field<LTC4162_DIE_TEMP_REG_SUBADDR, 0, LTC4162_WORD_SIZE> DIE_TEMP_REG;
+  typedef Field<LTC4162_THERMISTOR_VOLTAGE_REG_SUBADDR, 0, LTC4162_WORD_SIZE> THERMISTOR_VOLTAGE_REG;
+  typedef Field<LTC4162_BSR_REG_SUBADDR, 0, LTC4162_WORD_SIZE> BSR_REG;
+  typedef Field<LTC4162_JEITA_REGION_REG_SUBADDR, 0, LTC4162_WORD_SIZE> JEITA_REGION_REG;
+  typedef Field<LTC4162_CHEM_CELLS_REG_SUBADDR, 0, LTC4162_WORD_SIZE> CHEM_CELLS_REG;
+  typedef Field<LTC4162_ICHARGE_DAC_REG_SUBADDR, 0, LTC4162_WORD_SIZE> ICHARGE_DAC_REG;
+  typedef Field<LTC4162_VCHARGE_DAC_REG_SUBADDR, 0, LTC4162_WORD_SIZE> VCHARGE_DAC_REG;
+  typedef Field<LTC4162_IIN_LIMIT_DAC_REG_SUBADDR, 0, LTC4162_WORD_SIZE> IIN_LIMIT_DAC_REG;
+  typedef Field<LTC4162_VBAT_FILT_REG_SUBADDR, 0, LTC4162_WORD_SIZE> VBAT_FILT_REG;
+  typedef Field<LTC4162_BSR_CHARGE_CURRENT_REG_SUBADDR, 0, LTC4162_WORD_SIZE> BSR_CHARGE_CURRENT_REG;
+  typedef Field<LTC4162_TELEMETRY_STATUS_REG_SUBADDR, 0, LTC4162_WORD_SIZE> TELEMETRY_STATUS_REG;
+  typedef Field<LTC4162_INPUT_UNDERVOLTAGE_DAC_REG_SUBADDR, 0, LTC4162_WORD_SIZE> INPUT_UNDERVOLTAGE_DAC_REG;
+
+  /*! @name Bit Fields */
+  typedef Field<LTC4162_VBAT_LO_ALERT_LIMIT_SUBADDR, LTC4162_VBAT_LO_ALERT_LIMIT_OFFSET, LTC4162_VBAT_LO_ALERT_LIMIT_SIZE> VBAT_LO_ALERT_LIMIT;
+  typedef Field<LTC4162_VBAT_HI_ALERT_LIMIT_SUBADDR, LTC4162_VBAT_HI_ALERT_LIMIT_OFFSET, LTC4162_VBAT_HI_ALERT_LIMIT_SIZE> VBAT_HI_ALERT_LIMIT;
+  typedef Field<LTC4162_VIN_LO_ALERT_LIMIT_SUBADDR, LTC4162_VIN_LO_ALERT_LIMIT_OFFSET, LTC4162_VIN_LO_ALERT_LIMIT_SIZE> VIN_LO_ALERT_LIMIT;
+  typedef Field<LTC4162_VIN_HI_ALERT_LIMIT_SUBADDR, LTC4162_VIN_HI_ALERT_LIMIT_OFFSET, LTC4162_VIN_HI_ALERT_LIMIT_SIZE> VIN_HI_ALERT_LIMIT;
+  typedef Field<LTC4162_VOUT_LO_ALERT_LIMIT_SUBADDR, LTC4162_VOUT_LO_ALERT_LIMIT_OFFSET, LTC4162_VOUT_LO_ALERT_LIMIT_SIZE> VOUT_LO_ALERT_LIMIT;
+  typedef Field<LTC4162_VOUT_HI_ALERT_LIMIT_SUBADDR, LTC4162_VOUT_HI_ALERT_LIMIT_OFFSET, LTC4162_VOUT_HI_ALERT_LIMIT_SIZE> VOUT_HI_ALERT_LIMIT;
+  typedef Field<LTC4162_IIN_HI_ALERT_LIMIT_SUBADDR, LTC4162_IIN_HI_ALERT_LIMIT_OFFSET, LTC4162_IIN_HI_ALERT_LIMIT_SIZE> IIN_HI_ALERT_LIMIT;
+  typedef Field<LTC4162_IBAT_LO_ALERT_LIMIT_SUBADDR, LTC4162_IBAT_LO_ALERT_LIMIT_OFFSET, LTC4162_IBAT_LO_ALERT_LIMIT_SIZE> IBAT_LO_ALERT_LIMIT;
+  typedef Field<LTC4162_DIE_TEMP_HI_ALERT_LIMIT_SUBADDR, LTC4162_DIE_TEMP_HI_ALERT_LIMIT_OFFSET, LTC4162_DIE_TEMP_HI_ALERT_LIMIT_SIZE> DIE_TEMP_HI_ALERT_LIMIT;
+  typedef Field<LTC4162_BSR_HI_ALERT_LIMIT_SUBADDR, LTC4162_BSR_HI_ALERT_LIMIT_OFFSET, LTC4162_BSR_HI_ALERT_LIMIT_SIZE> BSR_HI_ALERT_LIMIT;
+  typedef Field<LTC4162_THERMISTOR_VOLTAGE_HI_ALERT_LIMIT_SUBADDR, LTC4162_THERMISTOR_VOLTAGE_HI_ALERT_LIMIT_OFFSET, LTC4162_THERMISTOR_VOLTAGE_HI_ALERT_LIMIT_SIZE> THERMISTOR_VOLTAGE_HI_ALERT_LIMIT;
+  typedef Field<LTC4162_THERMISTOR_VOLTAGE_LO_ALERT_LIMIT_SUBADDR, LTC4162_THERMISTOR_VOLTAGE_LO_ALERT_LIMIT_OFFSET, LTC4162_THERMISTOR_VOLTAGE_LO_ALERT_LIMIT_SIZE> THERMISTOR_VOLTAGE_LO_ALERT_LIMIT;
+  typedef Field<LTC4162_EN_TELEMETRY_VALID_ALERT_SUBADDR, LTC4162_EN_TELEMETRY_VALID_ALERT_OFFSET, LTC4162_EN_TELEMETRY_VALID_ALERT_SIZE> EN_TELEMETRY_VALID_ALERT;
+  typedef Field<LTC4162_EN_BSR_DONE_ALERT_SUBADDR, LTC4162_EN_BSR_DONE_ALERT_OFFSET, LTC4162_EN_BSR_DONE_ALERT_SIZE> EN_BSR_DONE_ALERT;
+  typedef Field<LTC4162_EN_VBAT_LO_ALERT_SUBADDR, LTC4162_EN_VBAT_LO_ALERT_OFFSET, LTC4162_EN_VBAT_LO_ALERT_SIZE> EN_VBAT_LO_ALERT;
+  typedef Field<LTC4162_EN_VBAT_HI_ALERT_SUBADDR, LTC4162_EN_VBAT_HI_ALERT_OFFSET, LTC4162_EN_VBAT_HI_ALERT_SIZE> EN_VBAT_HI_ALERT;
+  typedef Field<LTC4162_EN_VIN_LO_ALERT_SUBADDR, LTC4162_EN_VIN_LO_ALERT_OFFSET, LTC4162_EN_VIN_LO_ALERT_SIZE> EN_VIN_LO_ALERT;
+  typedef Field<LTC4162_EN_VIN_HI_ALERT_SUBADDR, LTC4162_EN_VIN_HI_ALERT_OFFSET, LTC4162_EN_VIN_HI_ALERT_SIZE> EN_VIN_HI_ALERT;
+  typedef Field<LTC4162_EN_VOUT_LO_ALERT_SUBADDR, LTC4162_EN_VOUT_LO_ALERT_OFFSET, LTC4162_EN_VOUT_LO_ALERT_SIZE> EN_VOUT_LO_ALERT;
+  typedef Field<LTC4162_EN_VOUT_HI_ALERT_SUBADDR, LTC4162_EN_VOUT_HI_ALERT_OFFSET, LTC4162_EN_VOUT_HI_ALERT_SIZE> EN_VOUT_HI_ALERT;
+  typedef Field<LTC4162_EN_IIN_HI_ALERT_SUBADDR, LTC4162_EN_IIN_HI_ALERT_OFFSET, LTC4162_EN_IIN_HI_ALERT_SIZE> EN_IIN_HI_ALERT;
+  typedef Field<LTC4162_EN_IBAT_LO_ALERT_SUBADDR, LTC4162_EN_IBAT_LO_ALERT_OFFSET, LTC4162_EN_IBAT_LO_ALERT_SIZE> EN_IBAT_LO_ALERT;
+  typedef Field<LTC4162_EN_DIE_TEMP_HI_ALERT_SUBADDR, LTC4162_EN_DIE_TEMP_HI_ALERT_OFFSET, LTC4162_EN_DIE_TEMP_HI_ALERT_SIZE> EN_DIE_TEMP_HI_ALERT;
+  typedef Field<LTC4162_EN_BSR_HI_ALERT_SUBADDR, LTC4162_EN_BSR_HI_ALERT_OFFSET, LTC4162_EN_BSR_HI_ALERT_SIZE> EN_BSR_HI_ALERT;
+  typedef Field<LTC4162_EN_THERMISTOR_VOLTAGE_HI_ALERT_SUBADDR, LTC4162_EN_THERMISTOR_VOLTAGE_HI_ALERT_OFFSET, LTC4162_EN_THERMISTOR_VOLTAGE_HI_ALERT_SIZE> EN_THERMISTOR_VOLTAGE_HI_ALERT;
+  typedef Field<LTC4162_EN_THERMISTOR_VOLTAGE_LO_ALERT_SUBADDR, LTC4162_EN_THERMISTOR_VOLTAGE_LO_ALERT_OFFSET, LTC4162_EN_THERMISTOR_VOLTAGE_LO_ALERT_SIZE> EN_THERMISTOR_VOLTAGE_LO_ALERT;
+  typedef Field<LTC4162_EN_BAT_DETECT_FAILED_FAULT_ALERT_SUBADDR, LTC4162_EN_BAT_DETECT_FAILED_FAULT_ALERT_OFFSET, LTC4162_EN_BAT_DETECT_FAILED_FAULT_ALERT_SIZE> EN_BAT_DETECT_FAILED_FAULT_ALERT;
+  typedef Field<LTC4162_EN_BATTERY_DETECTION_ALERT_SUBADDR, LTC4162_EN_BATTERY_DETECTION_ALERT_OFFSET, LTC4162_EN_BATTERY_DETECTION_ALERT_SIZE> EN_BATTERY_DETECTION_ALERT;
+  typedef Field<LTC4162_EN_CHARGER_SUSPENDED_ALERT_SUBADDR, LTC4162_EN_CHARGER_SUSPENDED_ALERT_OFFSET, LTC4162_EN_CHARGER_SUSPENDED_ALERT_SIZE> EN_CHARGER_SUSPENDED_ALERT;
+  typedef Field<LTC4162_EN_PRECHARGE_ALERT_SUBADDR, LTC4162_EN_PRECHARGE_ALERT_OFFSET, LTC4162_EN_PRECHARGE_ALERT_SIZE> EN_PRECHARGE_ALERT;
+  typedef Field<LTC4162_EN_CC_CV_CHARGE_ALERT_SUBADDR, LTC4162_EN_CC_CV_CHARGE_ALERT_OFFSET, LTC4162_EN_CC_CV_CHARGE_ALERT_SIZE> EN_CC_CV_CHARGE_ALERT;
+  typedef Field<LTC4162_EN_NTC_PAUSE_ALERT_SUBADDR, LTC4162_EN_NTC_PAUSE_ALERT_OFFSET, LTC4162_EN_NTC_PAUSE_ALERT_SIZE> EN_NTC_PAUSE_ALERT;
+  typedef Field<LTC4162_EN_TIMER_TERM_ALERT_SUBADDR, LTC4162_EN_TIMER_TERM_ALERT_OFFSET, LTC4162_EN_TIMER_TERM_ALERT_SIZE> EN_TIMER_TERM_ALERT;
+  typedef Field<LTC4162_EN_C_OVER_X_TERM_ALERT_SUBADDR, LTC4162_EN_C_OVER_X_TERM_ALERT_OFFSET, LTC4162_EN_C_OVER_X_TERM_ALERT_SIZE> EN_C_OVER_X_TERM_ALERT;
+  typedef Field<LTC4162_EN_MAX_CHARGE_TIME_ALERT_SUBADDR, LTC4162_EN_MAX_CHARGE_TIME_ALERT_OFFSET, LTC4162_EN_MAX_CHARGE_TIME_ALERT_SIZE> EN_MAX_CHARGE_TIME_ALERT;
+  typedef Field<LTC4162_EN_BAT_MISSING_FAULT_ALERT_SUBADDR, LTC4162_EN_BAT_MISSING_FAULT_ALERT_OFFSET, LTC4162_EN_BAT_MISSING_FAULT_ALERT_SIZE> EN_BAT_MISSING_FAULT_ALERT;
+  typedef Field<LTC4162_EN_BAT_SHORT_FAULT_ALERT_SUBADDR, LTC4162_EN_BAT_SHORT_FAULT_ALERT_OFFSET, LTC4162_EN_BAT_SHORT_FAULT_ALERT_SIZE> EN_BAT_SHORT_FAULT_ALERT;
+  typedef Field<LTC4162_EN_ILIM_REG_ACTIVE_ALERT_SUBADDR, LTC4162_EN_ILIM_REG_ACTIVE_ALERT_OFFSET, LTC4162_EN_ILIM_REG_ACTIVE_ALERT_SIZE> EN_ILIM_REG_ACTIVE_ALERT;
+  typedef Field<LTC4162_EN_THERMAL_REG_ACTIVE_ALERT_SUBADDR, LTC4162_EN_THERMAL_REG_ACTIVE_ALERT_OFFSET, LTC4162_EN_THERMAL_REG_ACTIVE_ALERT_SIZE> EN_THERMAL_REG_ACTIVE_ALERT;
+  typedef Field<LTC4162_EN_VIN_UVCL_ACTIVE_ALERT_SUBADDR, LTC4162_EN_VIN_UVCL_ACTIVE_ALERT_OFFSET, LTC4162_EN_VIN_UVCL_ACTIVE_ALERT_SIZE> EN_VIN_UVCL_ACTIVE_ALERT;
+  typedef Field<LTC4162_EN_IIN_LIMIT_ACTIVE_ALERT_SUBADDR, LTC4162_EN_IIN_LIMIT_ACTIVE_ALERT_OFFSET, LTC4162_EN_IIN_LIMIT_ACTIVE_ALERT_SIZE> EN_IIN_LIMIT_ACTIVE_ALERT;
+  typedef Field<LTC4162_EN_CONSTANT_CURRENT_ALERT_SUBADDR, LTC4162_EN_CONSTANT_CURRENT_ALERT_OFFSET, LTC4162_EN_CONSTANT_CURRENT_ALERT_SIZE> EN_CONSTANT_CURRENT_ALERT;
+  typedef Field<LTC4162_EN_CONSTANT_VOLTAGE_ALERT_SUBADDR, LTC4162_EN_CONSTANT_VOLTAGE_ALERT_OFFSET, LTC4162_EN_CONSTANT_VOLTAGE_ALERT_SIZE> EN_CONSTANT_VOLTAGE_ALERT;
+  typedef Field<LTC4162_THERMAL_REG_START_TEMP_SUBADDR, LTC4162_THERMAL_REG_START_TEMP_OFFSET, LTC4162_THERMAL_REG_START_TEMP_SIZE> THERMAL_REG_START_TEMP;
+  typedef Field<LTC4162_THERMAL_REG_END_TEMP_SUBADDR, LTC4162_THERMAL_REG_END_TEMP_OFFSET, LTC4162_THERMAL_REG_END_TEMP_SIZE> THERMAL_REG_END_TEMP;
+  typedef Field<LTC4162_SUSPEND_CHARGER_SUBADDR, LTC4162_SUSPEND_CHARGER_OFFSET, LTC4162_SUSPEND_CHARGER_SIZE> SUSPEND_CHARGER;
+  typedef Field<LTC4162_RUN_BSR_SUBADDR, LTC4162_RUN_BSR_OFFSET, LTC4162_RUN_BSR_SIZE> RUN_BSR;
+  typedef Field<LTC4162_TELEMETRY_SPEED_SUBADDR, LTC4162_TELEMETRY_SPEED_OFFSET, LTC4162_TELEMETRY_SPEED_SIZE> TELEMETRY_SPEED;
+  typedef Field<LTC4162_FORCE_TELEMETRY_ON_SUBADDR, LTC4162_FORCE_TELEMETRY_ON_OFFSET, LTC4162_FORCE_TELEMETRY_ON_SIZE> FORCE_TELEMETRY_ON;
+  typedef Field<LTC4162_MPPT_EN_SUBADDR, LTC4162_MPPT_EN_OFFSET, LTC4162_MPPT_EN_SIZE> MPPT_EN;
+  typedef Field<LTC4162_IIN_LIMIT_TARGET_SUBADDR, LTC4162_IIN_LIMIT_TARGET_OFFSET, LTC4162_IIN_LIMIT_TARGET_SIZE> IIN_LIMIT_TARGET;
+  typedef Field<LTC4162_INPUT_UNDERVOLTAGE_SETTING_SUBADDR, LTC4162_INPUT_UNDERVOLTAGE_SETTING_OFFSET, LTC4162_INPUT_UNDERVOLTAGE_SETTING_SIZE> INPUT_UNDERVOLTAGE_SETTING;
+  typedef Field<LTC4162_ARM_SHIP_MODE_SUBADDR, LTC4162_ARM_SHIP_MODE_OFFSET, LTC4162_ARM_SHIP_MODE_SIZE> ARM_SHIP_MODE;
+  typedef Field<LTC4162_CHARGE_CURRENT_SETTING_SUBADDR, LTC4162_CHARGE_CURRENT_SETTING_OFFSET, LTC4162_CHARGE_CURRENT_SETTING_SIZE> CHARGE_CURRENT_SETTING;
+  typedef Field<LTC4162_VCHARGE_SETTING_SUBADDR, LTC4162_VCHARGE_SETTING_OFFSET, LTC4162_VCHARGE_SETTING_SIZE> VCHARGE_SETTING;
+  typedef Field<LTC4162_C_OVER_X_THRESHOLD_SUBADDR, LTC4162_C_OVER_X_THRESHOLD_OFFSET, LTC4162_C_OVER_X_THRESHOLD_SIZE> C_OVER_X_THRESHOLD;
+  typedef Field<LTC4162_MAX_CV_TIME_SUBADDR, LTC4162_MAX_CV_TIME_OFFSET, LTC4162_MAX_CV_TIME_SIZE> MAX_CV_TIME;
+  typedef Field<LTC4162_MAX_CHARGE_TIME_SUBADDR, LTC4162_MAX_CHARGE_TIME_OFFSET, LTC4162_MAX_CHARGE_TIME_SIZE> MAX_CHARGE_TIME;
+  typedef Field<LTC4162_JEITA_T1_SUBADDR, LTC4162_JEITA_T1_OFFSET, LTC4162_JEITA_T1_SIZE> JEITA_T1;
+  typedef Field<LTC4162_JEITA_T2_SUBADDR, LTC4162_JEITA_T2_OFFSET, LTC4162_JEITA_T2_SIZE> JEITA_T2;
+  typedef Field<LTC4162_JEITA_T3_SUBADDR, LTC4162_JEITA_T3_OFFSET, LTC4162_JEITA_T3_SIZE> JEITA_T3;
+  typedef Field<LTC4162_JEITA_T4_SUBADDR, LTC4162_JEITA_T4_OFFSET, LTC4162_JEITA_T4_SIZE> JEITA_T4;
+  typedef Field<LTC4162_JEITA_T5_SUBADDR, LTC4162_JEITA_T5_OFFSET, LTC4162_JEITA_T5_SIZE> JEITA_T5;
+  typedef Field<LTC4162_JEITA_T6_SUBADDR, LTC4162_JEITA_T6_OFFSET, LTC4162_JEITA_T6_SIZE> JEITA_T6;
+  typedef Field<LTC4162_VCHARGE_JEITA_6_SUBADDR, LTC4162_VCHARGE_JEITA_6_OFFSET, LTC4162_VCHARGE_JEITA_6_SIZE> VCHARGE_JEITA_6;
+  typedef Field<LTC4162_VCHARGE_JEITA_5_SUBADDR, LTC4162_VCHARGE_JEITA_5_OFFSET, LTC4162_VCHARGE_JEITA_5_SIZE> VCHARGE_JEITA_5;
+  typedef Field<LTC4162_VCHARGE_JEITA_4_SUBADDR, LTC4162_VCHARGE_JEITA_4_OFFSET, LTC4162_VCHARGE_JEITA_4_SIZE> VCHARGE_JEITA_4;
+  typedef Field<LTC4162_VCHARGE_JEITA_3_SUBADDR, LTC4162_VCHARGE_JEITA_3_OFFSET, LTC4162_VCHARGE_JEITA_3_SIZE> VCHARGE_JEITA_3;
+  typedef Field<LTC4162_VCHARGE_JEITA_2_SUBADDR, LTC4162_VCHARGE_JEITA_2_OFFSET, LTC4162_VCHARGE_JEITA_2_SIZE> VCHARGE_JEITA_2;
+  typedef Field<LTC4162_ICHARGE_JEITA_6_SUBADDR, LTC4162_ICHARGE_JEITA_6_OFFSET, LTC4162_ICHARGE_JEITA_6_SIZE> ICHARGE_JEITA_6;
+  typedef Field<LTC4162_ICHARGE_JEITA_5_SUBADDR, LTC4162_ICHARGE_JEITA_5_OFFSET, LTC4162_ICHARGE_JEITA_5_SIZE> ICHARGE_JEITA_5;
+  typedef Field<LTC4162_ICHARGE_JEITA_4_SUBADDR, LTC4162_ICHARGE_JEITA_4_OFFSET, LTC4162_ICHARGE_JEITA_4_SIZE> ICHARGE_JEITA_4;
+  typedef Field<LTC4162_ICHARGE_JEITA_3_SUBADDR, LTC4162_ICHARGE_JEITA_3_OFFSET, LTC4162_ICHARGE_JEITA_3_SIZE> ICHARGE_JEITA_3;
+  typedef Field<LTC4162_ICHARGE_JEITA_2_SUBADDR, LTC4162_ICHARGE_JEITA_2_OFFSET, LTC4162_ICHARGE_JEITA_2_SIZE> ICHARGE_JEITA_2;
+  typedef Field<LTC4162_EN_C_OVER_X_TERM_SUBADDR, LTC4162_EN_C_OVER_X_TERM_OFFSET, LTC4162_EN_C_OVER_X_TERM_SIZE> EN_C_OVER_X_TERM;
+  typedef Field<LTC4162_EN_JEITA_SUBADDR, LTC4162_EN_JEITA_OFFSET, LTC4162_EN_JEITA_SIZE> EN_JEITA;
+  typedef Field<LTC4162_TCHARGETIMER_SUBADDR, LTC4162_TCHARGETIMER_OFFSET, LTC4162_TCHARGETIMER_SIZE> TCHARGETIMER;
+  typedef Field<LTC4162_TCVTIMER_SUBADDR, LTC4162_TCVTIMER_OFFSET, LTC4162_TCVTIMER_SIZE> TCVTIMER;
+  typedef Field<LTC4162_CHARGER_STATE_SUBADDR, LTC4162_CHARGER_STATE_OFFSET, LTC4162_CHARGER_STATE_SIZE> CHARGER_STATE;
+  typedef Field<LTC4162_CHARGE_STATUS_SUBADDR, LTC4162_CHARGE_STATUS_OFFSET, LTC4162_CHARGE_STATUS_SIZE> CHARGE_STATUS;
+  typedef Field<LTC4162_TELEMETRY_VALID_ALERT_SUBADDR, LTC4162_TELEMETRY_VALID_ALERT_OFFSET, LTC4162_TELEMETRY_VALID_ALERT_SIZE> TELEMETRY_VALID_ALERT;
+  typedef Field<LTC4162_BSR_DONE_ALERT_SUBADDR, LTC4162_BSR_DONE_ALERT_OFFSET, LTC4162_BSR_DONE_ALERT_SIZE> BSR_DONE_ALERT;
+  typedef Field<LTC4162_VBAT_LO_ALERT_SUBADDR, LTC4162_VBAT_LO_ALERT_OFFSET, LTC4162_VBAT_LO_ALERT_SIZE> VBAT_LO_ALERT;
+  typedef Field<LTC4162_VBAT_HI_ALERT_SUBADDR, LTC4162_VBAT_HI_ALERT_OFFSET, LTC4162_VBAT_HI_ALERT_SIZE> VBAT_HI_ALERT;
+  typedef Field<LTC4162_VIN_LO_ALERT_SUBADDR, LTC4162_VIN_LO_ALERT_OFFSET, LTC4162_VIN_LO_ALERT_SIZE> VIN_LO_ALERT;
+  typedef Field<LTC4162_VIN_HI_ALERT_SUBADDR, LTC4162_VIN_HI_ALERT_OFFSET, LTC4162_VIN_HI_ALERT_SIZE> VIN_HI_ALERT;
+  typedef Field<LTC4162_VOUT_LO_ALERT_SUBADDR, LTC4162_VOUT_LO_ALERT_OFFSET, LTC4162_VOUT_LO_ALERT_SIZE> VOUT_LO_ALERT;
+  typedef Field<LTC4162_VOUT_HI_ALERT_SUBADDR, LTC4162_VOUT_HI_ALERT_OFFSET, LTC4162_VOUT_HI_ALERT_SIZE> VOUT_HI_ALERT;
+  typedef Field<LTC4162_IIN_HI_ALERT_SUBADDR, LTC4162_IIN_HI_ALERT_OFFSET, LTC4162_IIN_HI_ALERT_SIZE> IIN_HI_ALERT;
+  typedef Field<LTC4162_IBAT_LO_ALERT_SUBADDR, LTC4162_IBAT_LO_ALERT_OFFSET, LTC4162_IBAT_LO_ALERT_SIZE> IBAT_LO_ALERT;
+  typedef Field<LTC4162_DIE_TEMP_HI_ALERT_SUBADDR, LTC4162_DIE_TEMP_HI_ALERT_OFFSET, LTC4162_DIE_TEMP_HI_ALERT_SIZE> DIE_TEMP_HI_ALERT;
+  typedef Field<LTC4162_BSR_HI_ALERT_SUBADDR, LTC4162_BSR_HI_ALERT_OFFSET, LTC4162_BSR_HI_ALERT_SIZE> BSR_HI_ALERT;
+  typedef Field<LTC4162_THERMISTOR_VOLTAGE_HI_ALERT_SUBADDR, LTC4162_THERMISTOR_VOLTAGE_HI_ALERT_OFFSET, LTC4162_THERMISTOR_VOLTAGE_HI_ALERT_SIZE> THERMISTOR_VOLTAGE_HI_ALERT;
+  typedef Field<LTC4162_THERMISTOR_VOLTAGE_LO_ALERT_SUBADDR, LTC4162_THERMISTOR_VOLTAGE_LO_ALERT_OFFSET, LTC4162_THERMISTOR_VOLTAGE_LO_ALERT_SIZE> THERMISTOR_VOLTAGE_LO_ALERT;
+  typedef Field<LTC4162_BAT_DETECT_FAILED_FAULT_ALERT_SUBADDR, LTC4162_BAT_DETECT_FAILED_FAULT_ALERT_OFFSET, LTC4162_BAT_DETECT_FAILED_FAULT_ALERT_SIZE> BAT_DETECT_FAILED_FAULT_ALERT;
+  typedef Field<LTC4162_BATTERY_DETECTION_ALERT_SUBADDR, LTC4162_BATTERY_DETECTION_ALERT_OFFSET, LTC4162_BATTERY_DETECTION_ALERT_SIZE> BATTERY_DETECTION_ALERT;
+  typedef Field<LTC4162_CHARGER_SUSPENDED_ALERT_SUBADDR, LTC4162_CHARGER_SUSPENDED_ALERT_OFFSET, LTC4162_CHARGER_SUSPENDED_ALERT_SIZE> CHARGER_SUSPENDED_ALERT;
+  typedef Field<LTC4162_PRECHARGE_ALERT_SUBADDR, LTC4162_PRECHARGE_ALERT_OFFSET, LTC4162_PRECHARGE_ALERT_SIZE> PRECHARGE_ALERT;
+  typedef Field<LTC4162_CC_CV_CHARGE_ALERT_SUBADDR, LTC4162_CC_CV_CHARGE_ALERT_OFFSET, LTC4162_CC_CV_CHARGE_ALERT_SIZE> CC_CV_CHARGE_ALERT;
+  typedef Field<LTC4162_NTC_PAUSE_ALERT_SUBADDR, LTC4162_NTC_PAUSE_ALERT_OFFSET, LTC4162_NTC_PAUSE_ALERT_SIZE> NTC_PAUSE_ALERT;
+  typedef Field<LTC4162_TIMER_TERM_ALERT_SUBADDR, LTC4162_TIMER_TERM_ALERT_OFFSET, LTC4162_TIMER_TERM_ALERT_SIZE> TIMER_TERM_ALERT;
+  typedef Field<LTC4162_C_OVER_X_TERM_ALERT_SUBADDR, LTC4162_C_OVER_X_TERM_ALERT_OFFSET, LTC4162_C_OVER_X_TERM_ALERT_SIZE> C_OVER_X_TERM_ALERT;
+  typedef Field<LTC4162_MAX_CHARGE_TIME_FAULT_ALERT_SUBADDR, LTC4162_MAX_CHARGE_TIME_FAULT_ALERT_OFFSET, LTC4162_MAX_CHARGE_TIME_FAULT_ALERT_SIZE> MAX_CHARGE_TIME_FAULT_ALERT;
+  typedef Field<LTC4162_BAT_MISSING_FAULT_ALERT_SUBADDR, LTC4162_BAT_MISSING_FAULT_ALERT_OFFSET, LTC4162_BAT_MISSING_FAULT_ALERT_SIZE> BAT_MISSING_FAULT_ALERT;
+  typedef Field<LTC4162_BAT_SHORT_FAULT_ALERT_SUBADDR, LTC4162_BAT_SHORT_FAULT_ALERT_OFFSET, LTC4162_BAT_SHORT_FAULT_ALERT_SIZE> BAT_SHORT_FAULT_ALERT;
+  typedef Field<LTC4162_ILIM_REG_ACTIVE_ALERT_SUBADDR, LTC4162_ILIM_REG_ACTIVE_ALERT_OFFSET, LTC4162_ILIM_REG_ACTIVE_ALERT_SIZE> ILIM_REG_ACTIVE_ALERT;
+  typedef Field<LTC4162_THERMAL_REG_ACTIVE_ALERT_SUBADDR, LTC4162_THERMAL_REG_ACTIVE_ALERT_OFFSET, LTC4162_THERMAL_REG_ACTIVE_ALERT_SIZE> THERMAL_REG_ACTIVE_ALERT;
+  typedef Field<LTC4162_VIN_UVCL_ACTIVE_ALERT_SUBADDR, LTC4162_VIN_UVCL_ACTIVE_ALERT_OFFSET, LTC4162_VIN_UVCL_ACTIVE_ALERT_SIZE> VIN_UVCL_ACTIVE_ALERT;
+  typedef Field<LTC4162_IIN_LIMIT_ACTIVE_ALERT_SUBADDR, LTC4162_IIN_LIMIT_ACTIVE_ALERT_OFFSET, LTC4162_IIN_LIMIT_ACTIVE_ALERT_SIZE> IIN_LIMIT_ACTIVE_ALERT;
+  typedef Field<LTC4162_CONSTANT_CURRENT_ALERT_SUBADDR, LTC4162_CONSTANT_CURRENT_ALERT_OFFSET, LTC4162_CONSTANT_CURRENT_ALERT_SIZE> CONSTANT_CURRENT_ALERT;
+  typedef Field<LTC4162_CONSTANT_VOLTAGE_ALERT_SUBADDR, LTC4162_CONSTANT_VOLTAGE_ALERT_OFFSET, LTC4162_CONSTANT_VOLTAGE_ALERT_SIZE> CONSTANT_VOLTAGE_ALERT;
+  typedef Field<LTC4162_EN_CHG_SUBADDR, LTC4162_EN_CHG_OFFSET, LTC4162_EN_CHG_SIZE> EN_CHG;
+  typedef Field<LTC4162_CELL_COUNT_ERR_SUBADDR, LTC4162_CELL_COUNT_ERR_OFFSET, LTC4162_CELL_COUNT_ERR_SIZE> CELL_COUNT_ERR;
+  typedef Field<LTC4162_NO_RT_SUBADDR, LTC4162_NO_RT_OFFSET, LTC4162_NO_RT_SIZE> NO_RT;
+  typedef Field<LTC4162_THERMAL_SHUTDOWN_SUBADDR, LTC4162_THERMAL_SHUTDOWN_OFFSET, LTC4162_THERMAL_SHUTDOWN_SIZE> THERMAL_SHUTDOWN;
+  typedef Field<LTC4162_VIN_OVLO_SUBADDR, LTC4162_VIN_OVLO_OFFSET, LTC4162_VIN_OVLO_SIZE> VIN_OVLO;
+  typedef Field<LTC4162_VIN_GT_VBAT_SUBADDR, LTC4162_VIN_GT_VBAT_OFFSET, LTC4162_VIN_GT_VBAT_SIZE> VIN_GT_VBAT;
+  typedef Field<LTC4162_VIN_GT_4P2V_SUBADDR, LTC4162_VIN_GT_4P2V_OFFSET, LTC4162_VIN_GT_4P2V_SIZE> VIN_GT_4P2V;
+  typedef Field<LTC4162_INTVCC_GT_2P8V_SUBADDR, LTC4162_INTVCC_GT_2P8V_OFFSET, LTC4162_INTVCC_GT_2P8V_SIZE> INTVCC_GT_2P8V;
+  typedef Field<LTC4162_VBAT_SUBADDR, LTC4162_VBAT_OFFSET, LTC4162_VBAT_SIZE> VBAT;
+  typedef Field<LTC4162_VIN_SUBADDR, LTC4162_VIN_OFFSET, LTC4162_VIN_SIZE> VIN;
+  typedef Field<LTC4162_VOUT_SUBADDR, LTC4162_VOUT_OFFSET, LTC4162_VOUT_SIZE> VOUT;
+  typedef Field<LTC4162_IBAT_SUBADDR, LTC4162_IBAT_OFFSET, LTC4162_IBAT_SIZE> IBAT;
+  typedef Field<LTC4162_IIN_SUBADDR, LTC4162_IIN_OFFSET, LTC4162_IIN_SIZE> IIN;
+  typedef Field<LTC4162_DIE_TEMP_SUBADDR, LTC4162_DIE_TEMP_OFFSET, LTC4162_DIE_TEMP_SIZE> DIE_TEMP;
+  typedef Field<LTC4162_THERMISTOR_VOLTAGE_SUBADDR, LTC4162_THERMISTOR_VOLTAGE_OFFSET, LTC4162_THERMISTOR_VOLTAGE_SIZE> THERMISTOR_VOLTAGE;
+  typedef Field<LTC4162_BSR_SUBADDR, LTC4162_BSR_OFFSET, LTC4162_BSR_SIZE> BSR;
+  typedef Field<LTC4162_JEITA_REGION_SUBADDR, LTC4162_JEITA_REGION_OFFSET, LTC4162_JEITA_REGION_SIZE> JEITA_REGION;
+  typedef Field<LTC4162_CHEM_SUBADDR, LTC4162_CHEM_OFFSET, LTC4162_CHEM_SIZE> CHEM;
+  typedef Field<LTC4162_CELL_COUNT_SUBADDR, LTC4162_CELL_COUNT_OFFSET, LTC4162_CELL_COUNT_SIZE> CELL_COUNT;
+  typedef Field<LTC4162_ICHARGE_DAC_SUBADDR, LTC4162_ICHARGE_DAC_OFFSET, LTC4162_ICHARGE_DAC_SIZE> ICHARGE_DAC;
+  typedef Field<LTC4162_VCHARGE_DAC_SUBADDR, LTC4162_VCHARGE_DAC_OFFSET, LTC4162_VCHARGE_DAC_SIZE> VCHARGE_DAC;
+  typedef Field<LTC4162_IIN_LIMIT_DAC_SUBADDR, LTC4162_IIN_LIMIT_DAC_OFFSET, LTC4162_IIN_LIMIT_DAC_SIZE> IIN_LIMIT_DAC;
+  typedef Field<LTC4162_VBAT_FILT_SUBADDR, LTC4162_VBAT_FILT_OFFSET, LTC4162_VBAT_FILT_SIZE> VBAT_FILT;
+  typedef Field<LTC4162_BSR_CHARGE_CURRENT_SUBADDR, LTC4162_BSR_CHARGE_CURRENT_OFFSET, LTC4162_BSR_CHARGE_CURRENT_SIZE> BSR_CHARGE_CURRENT;
+  typedef Field<LTC4162_BSR_QUESTIONABLE_SUBADDR, LTC4162_BSR_QUESTIONABLE_OFFSET, LTC4162_BSR_QUESTIONABLE_SIZE> BSR_QUESTIONABLE;
+  typedef Field<LTC4162_TELEMETRY_VALID_SUBADDR, LTC4162_TELEMETRY_VALID_OFFSET, LTC4162_TELEMETRY_VALID_SIZE> TELEMETRY_VALID;
+  typedef Field<LTC4162_INPUT_UNDERVOLTAGE_DAC_SUBADDR, LTC4162_INPUT_UNDERVOLTAGE_DAC_OFFSET, LTC4162_INPUT_UNDERVOLTAGE_DAC_SIZE> INPUT_UNDERVOLTAGE_DAC;
+}
+
+#endif /* LTC4162_FIELDS_HPP_ */
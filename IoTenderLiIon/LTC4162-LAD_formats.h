@@ -79,12 +79,25 @@ Generated on: 2018-03-09
  *  internal integer format to real values for display/debug. Invoking these macros results in
  *  runtime floating point calculations with associated high memory and execution penalty in
  *  small embedded systems.
+ *
+ *  Each linear integer/unsigned to real macro has an _I2FIX/_U2FIX counterpart returning an int32_t
+ *  in millivolts, milliamperes, millidegrees Celsius or microohms. Their coefficients are computed from
+ *  the constants below at compile time with 24 fractional bits, leaving one 64-bit multiply, add and
+ *  shift at runtime, and the result is within one unit of the rounded floating point conversion.
+ *
+ *  Their _FIX2I/_FIX2U inverses take the same units and return register values for setpoints computed at
+ *  runtime, such as an input undervoltage limit that tracks the battery. They use a 40 fractional bit multiply
+ *  in place of floating point and saturate instead of wrapping. Results equal the real to integer macros except
+ *  at exact halves such as 1025 mA for iinlim, which these round away from zero while the floating point
+ *  macros may not, as 1.025 has no exact binary representation.
  * @{
  */
 
 #ifndef LTC4162_FORMATS_H_
 #define LTC4162_FORMATS_H_
 
+#include <stdint.h>
+
 /*! @name Format Definitions
  *  Constants used by the macros below to convert between real and LTC4162 integer scaling.
  */
@@ -100,6 +113,8 @@ Generated on: 2018-03-09
 #define LTC4162_AVCLPROG 37.5
 #define LTC4162_ADCGAIN 18191.0
 #define LTC4162_VREF 1.2
+#define LTC4162_MILLI 1000
+#define LTC4162_MICRO 1000000
 #define LTC4162_Rm40 214063.67
 #define LTC4162_Rm34 152840.30
 #define LTC4162_Rm28 110480.73
@@ -126,69 +141,113 @@ Generated on: 2018-03-09
 /*! @name Use the macros below to convert between real and LTC4162 integer scaling. */
 /*! Convert from amperes to the iinlim setting.
  *   - Used with Bit Fields: iin_limit_target, iin_limit_dac, target_ilim.
+ *   - LTC4162_IINLIM_U2FIX returns milliamperes as an integer, without floating point.
+ *   - LTC4162_IINLIM_FIX2U converts from milliamperes, without floating point, saturating at the uint16_t limits.
  */
 #define LTC4162_IINLIM_R2U(x) (uint16_t)__LTC4162_ILINE__((LTC4162_VREF / 64 / LTC4162_AVCLPROG / LTC4162_RSNSI), (LTC4162_VREF / 64 / LTC4162_AVCLPROG / LTC4162_RSNSI * 2), (0), (1), x)
 #define LTC4162_IINLIM_U2R(y) __LTC4162_RLINE__((0), (1), (LTC4162_VREF / 64 / LTC4162_AVCLPROG / LTC4162_RSNSI), (LTC4162_VREF / 64 / LTC4162_AVCLPROG / LTC4162_RSNSI * 2), (uint16_t)(y))
+#define LTC4162_IINLIM_U2FIX(y) __LTC4162_FIXLINE__((0), (1), (LTC4162_VREF / 64 / LTC4162_AVCLPROG / LTC4162_RSNSI), (LTC4162_VREF / 64 / LTC4162_AVCLPROG / LTC4162_RSNSI * 2), LTC4162_MILLI, (uint16_t)(y))
+#define LTC4162_IINLIM_FIX2U(x) (uint16_t)__LTC4162_FIX2CODE__((LTC4162_VREF / 64 / LTC4162_AVCLPROG / LTC4162_RSNSI), (LTC4162_VREF / 64 / LTC4162_AVCLPROG / LTC4162_RSNSI * 2), (0), (1), LTC4162_MILLI, 0, 65535, x)
 
 /*! Convert from volts to the vcharge_liion setting.
  *   - Used with Bit Fields: vcharge_setting, vcharge_jeita_6, vcharge_jeita_5, vcharge_jeita_4, vcharge_jeita_3, vcharge_jeita_2, vcharge_dac.
+ *   - LTC4162_VCHARGE_LIION_U2FIX returns millivolts as an integer, without floating point.
+ *   - LTC4162_VCHARGE_LIION_FIX2U converts from millivolts, without floating point, saturating at the uint16_t limits.
  */
 #define LTC4162_VCHARGE_LIION_R2U(x) (uint16_t)__LTC4162_ILINE__((3.8125), (3.8125 + 0.0125), (0), (1), x)
 #define LTC4162_VCHARGE_LIION_U2R(y) __LTC4162_RLINE__((0), (1), (3.8125), (3.8125 + 0.0125), (uint16_t)(y))
+#define LTC4162_VCHARGE_LIION_U2FIX(y) __LTC4162_FIXLINE__((0), (1), (3.8125), (3.8125 + 0.0125), LTC4162_MILLI, (uint16_t)(y))
+#define LTC4162_VCHARGE_LIION_FIX2U(x) (uint16_t)__LTC4162_FIX2CODE__((3.8125), (3.8125 + 0.0125), (0), (1), LTC4162_MILLI, 0, 65535, x)
 
 /*! Convert from volts to the vin_uvcl setting.
  *   - Used with Bit Fields: input_undervoltage_setting, input_undervoltage_dac, input_undervoltage_mppt, mppt_vuvcl_dac_pmax.
+ *   - LTC4162_VIN_UVCL_U2FIX returns millivolts as an integer, without floating point.
+ *   - LTC4162_VIN_UVCL_FIX2U converts from millivolts, without floating point, saturating at the uint16_t limits.
  */
 #define LTC4162_VIN_UVCL_R2U(x) (uint16_t)__LTC4162_ILINE__((LTC4162_VREF / 256 * LTC4162_VINDIV), (LTC4162_VREF / 256 * LTC4162_VINDIV * 2), (0), (1), x)
 #define LTC4162_VIN_UVCL_U2R(y) __LTC4162_RLINE__((0), (1), (LTC4162_VREF / 256 * LTC4162_VINDIV), (LTC4162_VREF / 256 * LTC4162_VINDIV * 2), (uint16_t)(y))
+#define LTC4162_VIN_UVCL_U2FIX(y) __LTC4162_FIXLINE__((0), (1), (LTC4162_VREF / 256 * LTC4162_VINDIV), (LTC4162_VREF / 256 * LTC4162_VINDIV * 2), LTC4162_MILLI, (uint16_t)(y))
+#define LTC4162_VIN_UVCL_FIX2U(x) (uint16_t)__LTC4162_FIX2CODE__((LTC4162_VREF / 256 * LTC4162_VINDIV), (LTC4162_VREF / 256 * LTC4162_VINDIV * 2), (0), (1), LTC4162_MILLI, 0, 65535, x)
 
 /*! Convert from amperes to the charge_current_setting.
  *   - Used with Bit Fields: charge_current_setting, icharge_jeita_6, icharge_jeita_5, icharge_jeita_4, icharge_jeita_3, icharge_jeita_2, icharge_dac, target_icharge.
+ *   - LTC4162_ICHARGE_U2FIX returns milliamperes as an integer, without floating point.
+ *   - LTC4162_ICHARGE_FIX2U converts from milliamperes, without floating point, saturating at the uint16_t limits.
  */
 #define LTC4162_ICHARGE_R2U(x) (uint16_t)__LTC4162_ILINE__((LTC4162_VREF / 32 / LTC4162_AVPROG / LTC4162_RSNSB), (LTC4162_VREF / 32 / LTC4162_AVPROG / LTC4162_RSNSB * 2), (0), (1), x)
 #define LTC4162_ICHARGE_U2R(y) __LTC4162_RLINE__((0), (1), (LTC4162_VREF / 32 / LTC4162_AVPROG / LTC4162_RSNSB), (LTC4162_VREF / 32 / LTC4162_AVPROG / LTC4162_RSNSB * 2), (uint16_t)(y))
+#define LTC4162_ICHARGE_U2FIX(y) __LTC4162_FIXLINE__((0), (1), (LTC4162_VREF / 32 / LTC4162_AVPROG / LTC4162_RSNSB), (LTC4162_VREF / 32 / LTC4162_AVPROG / LTC4162_RSNSB * 2), LTC4162_MILLI, (uint16_t)(y))
+#define LTC4162_ICHARGE_FIX2U(x) (uint16_t)__LTC4162_FIX2CODE__((LTC4162_VREF / 32 / LTC4162_AVPROG / LTC4162_RSNSB), (LTC4162_VREF / 32 / LTC4162_AVPROG / LTC4162_RSNSB * 2), (0), (1), LTC4162_MILLI, 0, 65535, x)
 
 /*! Convert from volts to the per-cell vbat ADC reading.
  *   - Used with Bit Fields: vbat_lo_alert_limit, vbat_hi_alert_limit, vbat, vbat_filt.
+ *   - LTC4162_VBAT_FORMAT_I2FIX returns millivolts as an integer, without floating point.
+ *   - LTC4162_VBAT_FORMAT_FIX2I converts from millivolts, without floating point, saturating at the int16_t limits.
  */
 #define LTC4162_VBAT_FORMAT_R2I(x) (int16_t)__LTC4162_ILINE__((0), (LTC4162_BATDIV / LTC4162_ADCGAIN), (0), (1), x)
 #define LTC4162_VBAT_FORMAT_I2R(y) __LTC4162_RLINE__((0), (1), (0), (LTC4162_BATDIV / LTC4162_ADCGAIN), (int16_t)(y))
+#define LTC4162_VBAT_FORMAT_I2FIX(y) __LTC4162_FIXLINE__((0), (1), (0), (LTC4162_BATDIV / LTC4162_ADCGAIN), LTC4162_MILLI, (int16_t)(y))
+#define LTC4162_VBAT_FORMAT_FIX2I(x) (int16_t)__LTC4162_FIX2CODE__((0), (LTC4162_BATDIV / LTC4162_ADCGAIN), (0), (1), LTC4162_MILLI, -32768, 32767, x)
 
 /*! Convert from amperes to the ibat ADC reading.
  *   - Used with Bit Fields: ibat_lo_alert_limit, c_over_x_threshold, ibat, bsr_charge_current, mppt_ichrg, mppt_ichrg_max, mppt_ichrg_last.
+ *   - LTC4162_IBAT_FORMAT_I2FIX returns milliamperes as an integer, without floating point.
+ *   - LTC4162_IBAT_FORMAT_FIX2I converts from milliamperes, without floating point, saturating at the int16_t limits.
  */
 #define LTC4162_IBAT_FORMAT_R2I(x) (int16_t)__LTC4162_ILINE__((0), (1 / LTC4162_RSNSB / LTC4162_AVPROG / LTC4162_ADCGAIN), (0), (1), x)
 #define LTC4162_IBAT_FORMAT_I2R(y) __LTC4162_RLINE__((0), (1), (0), (1 / LTC4162_RSNSB / LTC4162_AVPROG / LTC4162_ADCGAIN), (int16_t)(y))
+#define LTC4162_IBAT_FORMAT_I2FIX(y) __LTC4162_FIXLINE__((0), (1), (0), (1 / LTC4162_RSNSB / LTC4162_AVPROG / LTC4162_ADCGAIN), LTC4162_MILLI, (int16_t)(y))
+#define LTC4162_IBAT_FORMAT_FIX2I(x) (int16_t)__LTC4162_FIX2CODE__((0), (1 / LTC4162_RSNSB / LTC4162_AVPROG / LTC4162_ADCGAIN), (0), (1), LTC4162_MILLI, -32768, 32767, x)
 
 /*! Convert from volts to the vout ADC reading.
  *   - Used with Bit Fields: vout_lo_alert_limit, vout_hi_alert_limit, vout.
+ *   - LTC4162_VOUT_FORMAT_I2FIX returns millivolts as an integer, without floating point.
+ *   - LTC4162_VOUT_FORMAT_FIX2I converts from millivolts, without floating point, saturating at the int16_t limits.
  */
 #define LTC4162_VOUT_FORMAT_R2I(x) (int16_t)__LTC4162_ILINE__((0), (LTC4162_VOUTDIV / LTC4162_ADCGAIN), (0), (1), x)
 #define LTC4162_VOUT_FORMAT_I2R(y) __LTC4162_RLINE__((0), (1), (0), (LTC4162_VOUTDIV / LTC4162_ADCGAIN), (int16_t)(y))
+#define LTC4162_VOUT_FORMAT_I2FIX(y) __LTC4162_FIXLINE__((0), (1), (0), (LTC4162_VOUTDIV / LTC4162_ADCGAIN), LTC4162_MILLI, (int16_t)(y))
+#define LTC4162_VOUT_FORMAT_FIX2I(x) (int16_t)__LTC4162_FIX2CODE__((0), (LTC4162_VOUTDIV / LTC4162_ADCGAIN), (0), (1), LTC4162_MILLI, -32768, 32767, x)
 
 /*! Convert from volts to the vin ADC reading.
  *   - Used with Bit Fields: vin_lo_alert_limit, vin_hi_alert_limit, vin, mppt_vin_init.
+ *   - LTC4162_VIN_FORMAT_I2FIX returns millivolts as an integer, without floating point.
+ *   - LTC4162_VIN_FORMAT_FIX2I converts from millivolts, without floating point, saturating at the int16_t limits.
  */
 #define LTC4162_VIN_FORMAT_R2I(x) (int16_t)__LTC4162_ILINE__((0), (LTC4162_VINDIV / LTC4162_ADCGAIN), (0), (1), x)
 #define LTC4162_VIN_FORMAT_I2R(y) __LTC4162_RLINE__((0), (1), (0), (LTC4162_VINDIV / LTC4162_ADCGAIN), (int16_t)(y))
+#define LTC4162_VIN_FORMAT_I2FIX(y) __LTC4162_FIXLINE__((0), (1), (0), (LTC4162_VINDIV / LTC4162_ADCGAIN), LTC4162_MILLI, (int16_t)(y))
+#define LTC4162_VIN_FORMAT_FIX2I(x) (int16_t)__LTC4162_FIX2CODE__((0), (LTC4162_VINDIV / LTC4162_ADCGAIN), (0), (1), LTC4162_MILLI, -32768, 32767, x)
 
 /*! Convert from amperes to the iin ADC reading.
  *   - Used with Bit Fields: iin_hi_alert_limit, iin.
+ *   - LTC4162_IIN_FORMAT_I2FIX returns milliamperes as an integer, without floating point.
+ *   - LTC4162_IIN_FORMAT_FIX2I converts from milliamperes, without floating point, saturating at the int16_t limits.
  */
 #define LTC4162_IIN_FORMAT_R2I(x) (int16_t)__LTC4162_ILINE__((0), (1 / LTC4162_RSNSI / LTC4162_AVCLPROG / LTC4162_ADCGAIN), (0), (1), x)
 #define LTC4162_IIN_FORMAT_I2R(y) __LTC4162_RLINE__((0), (1), (0), (1 / LTC4162_RSNSI / LTC4162_AVCLPROG / LTC4162_ADCGAIN), (int16_t)(y))
+#define LTC4162_IIN_FORMAT_I2FIX(y) __LTC4162_FIXLINE__((0), (1), (0), (1 / LTC4162_RSNSI / LTC4162_AVCLPROG / LTC4162_ADCGAIN), LTC4162_MILLI, (int16_t)(y))
+#define LTC4162_IIN_FORMAT_FIX2I(x) (int16_t)__LTC4162_FIX2CODE__((0), (1 / LTC4162_RSNSI / LTC4162_AVCLPROG / LTC4162_ADCGAIN), (0), (1), LTC4162_MILLI, -32768, 32767, x)
 
 /*! Convert from Ω to the per-cell bsr ADC reading.
  *   - Used with Bit Fields: bsr_hi_alert_limit, bsr.
+ *   - LTC4162_BSR_FORMAT_U2FIX returns microohms as an integer, without floating point.
+ *   - LTC4162_BSR_FORMAT_FIX2U converts from microohms, without floating point, saturating at the uint16_t limits.
  */
 #define LTC4162_BSR_FORMAT_R2U(x) (uint16_t)__LTC4162_ILINE__((0), (LTC4162_RSNSB * LTC4162_AVPROG * LTC4162_BATDIV / 65536), (0), (1), x)
 #define LTC4162_BSR_FORMAT_U2R(y) __LTC4162_RLINE__((0), (1), (0), (LTC4162_RSNSB * LTC4162_AVPROG * LTC4162_BATDIV / 65536), (uint16_t)(y))
+#define LTC4162_BSR_FORMAT_U2FIX(y) __LTC4162_FIXLINE__((0), (1), (0), (LTC4162_RSNSB * LTC4162_AVPROG * LTC4162_BATDIV / 65536), LTC4162_MICRO, (uint16_t)(y))
+#define LTC4162_BSR_FORMAT_FIX2U(x) (uint16_t)__LTC4162_FIX2CODE__((0), (LTC4162_RSNSB * LTC4162_AVPROG * LTC4162_BATDIV / 65536), (0), (1), LTC4162_MICRO, 0, 65535, x)
 
 /*! Convert from °C to the die_temp ADC reading.
  *   - Used with Bit Fields: die_temp_hi_alert_limit, thermal_reg_start_temp, thermal_reg_end_temp, die_temp.
+ *   - LTC4162_DIE_TEMP_FORMAT_I2FIX returns millidegrees Celsius as an integer, without floating point.
+ *   - LTC4162_DIE_TEMP_FORMAT_FIX2I converts from millidegrees Celsius, without floating point, saturating at the int16_t limits.
  */
 #define LTC4162_DIE_TEMP_FORMAT_R2I(x) (int16_t)__LTC4162_ILINE__((-264.4), (-264.4 + 1 / 46.557), (0), (1), x)
 #define LTC4162_DIE_TEMP_FORMAT_I2R(y) __LTC4162_RLINE__((0), (1), (-264.4), (-264.4 + 1 / 46.557), (int16_t)(y))
+#define LTC4162_DIE_TEMP_FORMAT_I2FIX(y) __LTC4162_FIXLINE__((0), (1), (-264.4), (-264.4 + 1 / 46.557), LTC4162_MILLI, (int16_t)(y))
+#define LTC4162_DIE_TEMP_FORMAT_FIX2I(x) (int16_t)__LTC4162_FIX2CODE__((-264.4), (-264.4 + 1 / 46.557), (0), (1), LTC4162_MILLI, -32768, 32767, x)
 
 /*! Convert from °C to the thermistor ADC reading.
  *   - Used with Bit Fields: thermistor_voltage_hi_alert_limit, thermistor_voltage_lo_alert_limit, jeita_t1, jeita_t2, jeita_t3, jeita_t4, jeita_t5, jeita_t6, thermistor_voltage.
@@ -292,10 +351,36 @@ Generated on: 2018-03-09
 #define __LTC4162_ROUND__(x) ((x) > 0 ? (x) + 0.5 : (x) - 0.5)
 #define __LTC4162_ILINE__(x0,x1,y0,y1,x) __LTC4162_ROUND__((y0) + ((double)((y1) - (y0))/(double)((x1) - (x0))) * ((x) - (x0)))
 #define __LTC4162_RLINE__(x0,x1,y0,y1,x) ((y0) + (double)((y1) - (y0))/(double)((x1) - (x0)) * ((x) - (x0)))
+#define __LTC4162_FIXLINE__(x0,x1,y0,y1,unit,x) (int32_t)(((int64_t)__LTC4162_ROUND__((double)(y0) * (unit) * 16777216.0) + \
+  (int64_t)__LTC4162_ROUND__((double)((y1) - (y0)) / (double)((x1) - (x0)) * (unit) * 16777216.0) * ((x) - (x0)) + 8388608) >> 24)
+#define __LTC4162_FIX2CODE__(x0,x1,y0,y1,unit,min,max,x) __LTC4162_fix2code((int32_t)(x), \
+  (int32_t)__LTC4162_ROUND__(((x0) + ((min) - 1 - (y0)) * (double)((x1) - (x0)) / (double)((y1) - (y0))) * (unit)), \
+  (int32_t)__LTC4162_ROUND__(((x0) + ((max) + 1 - (y0)) * (double)((x1) - (x0)) / (double)((y1) - (y0))) * (unit)), \
+  (int64_t)__LTC4162_ROUND__(((y0) - (double)((y1) - (y0)) / (double)((x1) - (x0)) * (x0)) * 1099511627776.0), \
+  (int64_t)__LTC4162_AWAY__((double)((y1) - (y0)) / (double)((x1) - (x0)) / (unit) * 1099511627776.0), (min), (max))
+#define __LTC4162_AWAY__(x) ((x) > 0 ? (x) + 1 : (x) - 1) // Next fixed point step away from zero, so exact halves still round away from zero
 #define __LTC4162_BETWEEN_INCLUSIVE__(x0,x1,x) (((x) > (x0) && (x) < (x1)) || (x) == (x0) || (x) == (x1) ? 1 : 0)
 #define __LTC4162_BELOW__(x0,x) ((x) < (x0) ? 1 : 0)
 #define __LTC4162_ABOVE__(xn,x) ((x) > (xn) ? 1 : 0)
 
+/* Register value for x in fixed point units: x is first limited to where the result saturates anyway, so that
+   intercept + slope * x, with 40 fractional bits, cannot overflow. */
+static inline int32_t __LTC4162_fix2code(int32_t x, int32_t x_min, int32_t x_max, int64_t intercept, int64_t slope, int32_t min, int32_t max)
+{
+  int64_t code;
+  if (x_min > x_max)
+  {
+    int32_t swap = x_min;
+    x_min = x_max;
+    x_max = swap;
+  }
+  if (x < x_min) x = x_min;
+  if (x > x_max) x = x_max;
+  code = intercept + slope * x;
+  code = code >= 0 ? (code + 549755813888LL) >> 40 : -((-code + 549755813888LL) >> 40);
+  return code < min ? min : code > max ? max : (int32_t)code;
+}
+
 
 /*! @} */
 
@@ -0,0 +1,187 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-L is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters including termination algorithms as
+well as numerous system status alerts. The LTC4162-L can charge Lithium-Ion cell
+stacks as high as eight cells with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-L is
+available in an I²C adjustable version as well as 4.0V, 4.1V and 4.2V fixed
+voltage versions all with and without MPPT enabled by default. The LTC4162-L is
+available in the 28-pin 4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date: 2018-03-09 17:54:10 -0500 (Fri, 09 Mar 2018) $
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-LAD
+ *  @brief LTC4162-LAD Linux i2c-dev SMBus port.
+ */
+
+#if defined(__linux__) && !defined(ARDUINO)
+
+#include "LTC4162-LAD_linux.h"
+#include "LTC4162-LAD_pec.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+#ifndef I2C_RDWR_IOCTL_MAX_MSGS
+#define I2C_RDWR_IOCTL_MAX_MSGS 42 // Kernel limit on messages per I2C_RDWR call
+#endif
+#define LIST_BATCH (I2C_RDWR_IOCTL_MAX_MSGS / 2) // Each register read is a write message and a read message
+
+int LTC4162_linux_open(struct port_configuration *pc, const char *device)
+{
+  pc->lock_depth = 0;
+  pc->file_descriptor = open(device, O_RDWR);
+  if (pc->file_descriptor < 0) return errno;
+  return 0;
+}
+
+void LTC4162_linux_close(struct port_configuration *pc)
+{
+  close(pc->file_descriptor);
+  pc->file_descriptor = -1;
+  pc->lock_depth = 0;
+}
+
+int LTC4162_linux_lock(struct port_configuration *pc)
+{
+  if (pc->lock_depth == 0 && flock(pc->file_descriptor, LOCK_EX) < 0) return errno;
+  pc->lock_depth++;
+  return 0;
+}
+
+int LTC4162_linux_unlock(struct port_configuration *pc)
+{
+  if (pc->lock_depth == 0) return EINVAL;
+  if (--pc->lock_depth == 0 && flock(pc->file_descriptor, LOCK_UN) < 0) return errno;
+  return 0;
+}
+
+/* Issues the messages in one I2C_RDWR call while holding the lock. Returns 0 or an errno value. */
+static int transfer(struct port_configuration *pc, struct i2c_msg *messages, uint32_t count)
+{
+  struct i2c_rdwr_ioctl_data transaction;
+  int ret_val = LTC4162_linux_lock(pc);
+  if (ret_val) return ret_val;
+  transaction.msgs = messages;
+  transaction.nmsgs = count;
+  if (ioctl(pc->file_descriptor, I2C_RDWR, &transaction) < 0) ret_val = errno;
+  LTC4162_linux_unlock(pc);
+  return ret_val;
+}
+
+int LTC4162_linux_read_register(uint8_t address, uint8_t command_code, uint16_t *data, struct port_configuration *pc)
+{
+  return LTC4162_linux_read_register_list(address, &command_code, data, 1, pc);
+}
+
+int LTC4162_linux_write_register(uint8_t address, uint8_t command_code, uint16_t data, struct port_configuration *pc)
+{
+  uint8_t buffer[4];
+  struct i2c_msg message;
+  buffer[0] = command_code;
+  buffer[1] = data & 0xFF;
+  buffer[2] = (data >> 8) & 0xFF;
+  buffer[3] = pec_write_word(address, command_code, data);
+  message.addr = address;
+  message.flags = 0;
+  message.len = sizeof(buffer);
+  message.buf = buffer;
+  return transfer(pc, &message, 1);
+}
+
+int LTC4162_linux_read_register_list(uint8_t address, const uint8_t *command_codes, uint16_t *data, uint8_t count, struct port_configuration *pc)
+{
+  struct i2c_msg messages[LIST_BATCH * 2];
+  uint8_t commands[LIST_BATCH];
+  uint8_t buffers[LIST_BATCH][3];
+  uint8_t batch, i;
+  int ret_val = LTC4162_linux_lock(pc); // One hold for the whole list, even if it spans several calls.
+  if (ret_val) return ret_val;
+  while (count && !ret_val)
+  {
+    batch = count < LIST_BATCH ? count : LIST_BATCH;
+    for (i = 0; i < batch; i++)
+    {
+      commands[i] = command_codes[i];
+      messages[2 * i].addr = address;
+      messages[2 * i].flags = 0;
+      messages[2 * i].len = 1;
+      messages[2 * i].buf = &commands[i];
+      messages[2 * i + 1].addr = address;
+      messages[2 * i + 1].flags = I2C_M_RD;
+      messages[2 * i + 1].len = 3;
+      messages[2 * i + 1].buf = buffers[i];
+    }
+    ret_val = transfer(pc, messages, 2 * batch);
+    for (i = 0; i < batch && !ret_val; i++)
+    {
+      data[i] = buffers[i][1] << 8 | buffers[i][0];
+      if (buffers[i][2] != pec_read_word(address, command_codes[i], data[i])) ret_val = EBADMSG;
+    }
+    command_codes += batch;
+    data += batch;
+    count -= batch;
+  }
+  LTC4162_linux_unlock(pc);
+  return ret_val;
+}
+
+#endif /* __linux__ && !ARDUINO */
@@ -0,0 +1,161 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-L is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters including termination algorithms as
+well as numerous system status alerts. The LTC4162-L can charge Lithium-Ion cell
+stacks as high as eight cells with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-L is
+available in an I²C adjustable version as well as 4.0V, 4.1V and 4.2V fixed
+voltage versions all with and without MPPT enabled by default. The LTC4162-L is
+available in the 28-pin 4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date: 2018-03-09 17:54:10 -0500 (Fri, 09 Mar 2018) $
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-LAD
+ *  @brief LTC4162-LAD table driven NTC thermistor conversion.
+ */
+
+#include "LTC4162-LAD_ntc.h"
+#ifdef ARDUINO
+#include <pgmspace.h>
+#else
+#include <string.h>
+#define PROGMEM
+#define memcpy_P memcpy
+#endif
+
+static const LTC4162_ntc_point_t ntcs0402e3103flt_points[] PROGMEM =
+{
+  LTC4162_NTC_POINT(-40, LTC4162_Rm40, -34, LTC4162_Rm34),
+  LTC4162_NTC_POINT(-34, LTC4162_Rm34, -28, LTC4162_Rm28),
+  LTC4162_NTC_POINT(-28, LTC4162_Rm28, -21, LTC4162_Rm21),
+  LTC4162_NTC_POINT(-21, LTC4162_Rm21, -14, LTC4162_Rm14),
+  LTC4162_NTC_POINT(-14, LTC4162_Rm14, -6, LTC4162_Rm6),
+  LTC4162_NTC_POINT(-6, LTC4162_Rm6, 4, LTC4162_R4),
+  LTC4162_NTC_POINT(4, LTC4162_R4, 33, LTC4162_R33),
+  LTC4162_NTC_POINT(33, LTC4162_R33, 44, LTC4162_R44),
+  LTC4162_NTC_POINT(44, LTC4162_R44, 53, LTC4162_R53),
+  LTC4162_NTC_POINT(53, LTC4162_R53, 62, LTC4162_R62),
+  LTC4162_NTC_POINT(62, LTC4162_R62, 70, LTC4162_R70),
+  LTC4162_NTC_POINT(70, LTC4162_R70, 78, LTC4162_R78),
+  LTC4162_NTC_POINT(78, LTC4162_R78, 86, LTC4162_R86),
+  LTC4162_NTC_POINT(86, LTC4162_R86, 94, LTC4162_R94),
+  LTC4162_NTC_POINT(94, LTC4162_R94, 102, LTC4162_R102),
+  LTC4162_NTC_POINT(102, LTC4162_R102, 110, LTC4162_R110),
+  LTC4162_NTC_POINT(110, LTC4162_R110, 118, LTC4162_R118),
+  LTC4162_NTC_POINT(118, LTC4162_R118, 126, LTC4162_R126),
+  LTC4162_NTC_POINT(126, LTC4162_R126, 134, LTC4162_R134),
+  LTC4162_NTC_POINT(134, LTC4162_R134, 142, LTC4162_R142),
+  LTC4162_NTC_POINT(142, LTC4162_R142, 150, LTC4162_R150),
+  LTC4162_NTC_POINT(150, LTC4162_R150, 142, LTC4162_R142),
+};
+
+const LTC4162_ntc_curve_t LTC4162_ntcs0402e3103flt =
+{
+  ntcs0402e3103flt_points,
+  sizeof(ntcs0402e3103flt_points) / sizeof(ntcs0402e3103flt_points[0])
+};
+
+/* Index of the first breakpoint of the segment holding code, the first or last segment when code lies beyond the table.
+   Codes fall as temperature rises. */
+static uint8_t segment_by_code(const LTC4162_ntc_curve_t *curve, int16_t code)
+{
+  uint8_t low = 0;
+  uint8_t high = curve->count - 2;
+  LTC4162_ntc_point_t point;
+  while (low < high)
+  {
+    uint8_t middle = (low + high + 1) / 2;
+    memcpy_P(&point, &curve->points[middle], sizeof(point));
+    if (point.code >= code) low = middle;
+    else high = middle - 1;
+  }
+  return low;
+}
+
+/* Index of the first breakpoint of the segment holding mdegc, the first or last segment beyond the table. */
+static uint8_t segment_by_temperature(const LTC4162_ntc_curve_t *curve, int32_t mdegc)
+{
+  uint8_t low = 0;
+  uint8_t high = curve->count - 2;
+  LTC4162_ntc_point_t point;
+  while (low < high)
+  {
+    uint8_t middle = (low + high + 1) / 2;
+    memcpy_P(&point, &curve->points[middle], sizeof(point));
+    if (point.degc * (int32_t)1000 <= mdegc) low = middle;
+    else high = middle - 1;
+  }
+  return low;
+}
+
+int32_t LTC4162_ntc_i2fix(const LTC4162_ntc_curve_t *curve, int16_t code)
+{
+  LTC4162_ntc_point_t point;
+  memcpy_P(&point, &curve->points[segment_by_code(curve, code)], sizeof(point));
+  return point.degc * (int32_t)1000 + (int32_t)(((int64_t)(code - point.code) * point.mdegc_per_code_q12 + 2048) >> 12);
+}
+
+int16_t LTC4162_ntc_fix2i(const LTC4162_ntc_curve_t *curve, int32_t mdegc)
+{
+  LTC4162_ntc_point_t point;
+  int32_t code;
+  memcpy_P(&point, &curve->points[segment_by_temperature(curve, mdegc)], sizeof(point));
+  code = point.code + (int32_t)(((int64_t)(mdegc - point.degc * (int32_t)1000) * point.codes_per_mdegc_q16 + 32768) >> 16);
+  if (code > INT16_MAX) return INT16_MAX;
+  if (code < INT16_MIN) return INT16_MIN;
+  return (int16_t)code;
+}
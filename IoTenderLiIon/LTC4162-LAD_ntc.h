@@ -0,0 +1,134 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-L is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters including termination algorithms as
+well as numerous system status alerts. The LTC4162-L can charge Lithium-Ion cell
+stacks as high as eight cells with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-L is
+available in an I²C adjustable version as well as 4.0V, 4.1V and 4.2V fixed
+voltage versions all with and without MPPT enabled by default. The LTC4162-L is
+available in the 28-pin 4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date: 2018-03-09 17:54:10 -0500 (Fri, 09 Mar 2018) $
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-LAD
+ *  @brief LTC4162-LAD table driven NTC thermistor conversion.
+ *
+ *  Integer replacements for LTC4162_NTCS0402E3103FLT_I2R and LTC4162_NTCS0402E3103FLT_R2I from
+ *  LTC4162-LAD_formats.h, for runtime use. A curve is a table of (temperature, resistance) breakpoints,
+ *  sorted by rising temperature, whose thermistor_voltage codes and segment slopes are computed at compile
+ *  time from the bias network constants in LTC4162-LAD_formats.h and kept in flash (PROGMEM). A conversion
+ *  is a binary search for the segment and one integer multiply and shift to interpolate along it, extrapolating
+ *  the end segments beyond the table just as the macros do.
+ *
+ *  Other thermistors are supported by building a table of @ref LTC4162_NTC_POINT entries from their
+ *  datasheet resistance curve and passing a curve describing it.
+ */
+
+#ifndef LTC4162_NTC_H_
+#define LTC4162_NTC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "LTC4162-LAD_formats.h"
+
+  /*! One breakpoint and the slope of the segment from it to the next one. */
+  typedef struct
+  {
+    int16_t code;                //!< thermistor_voltage reading at this temperature
+    int16_t degc;                //!< Temperature in °C
+    int32_t mdegc_per_code_q12;  //!< Segment slope in millidegrees per code, 12 fractional bits
+    int32_t codes_per_mdegc_q16; //!< Segment slope in codes per millidegree, 16 fractional bits
+  } LTC4162_ntc_point_t;
+
+  /*! thermistor_voltage reading for a thermistor resistance in ohms, including the series resistor, folded at compile time. */
+#define LTC4162_NTC_CODE(r) ((double)((r) + LTC4162_RNTCSER) / ((r) + LTC4162_RNTCSER + LTC4162_RNTCBIAS) * LTC4162_ADCGAIN * LTC4162_VREF)
+  /*! Table entry for the breakpoint t0 °C at r0 Ω, with the segment towards the neighbouring breakpoint t1 °C at r1 Ω.
+      The last entry of a table names the breakpoint before it as its neighbour. */
+#define LTC4162_NTC_POINT(t0, r0, t1, r1) \
+  { \
+    (int16_t)__LTC4162_ROUND__(LTC4162_NTC_CODE(r0)), (t0), \
+    (int32_t)__LTC4162_ROUND__(((t1) - (t0)) * 1000.0 * 4096 / (LTC4162_NTC_CODE(r1) - LTC4162_NTC_CODE(r0))), \
+    (int32_t)__LTC4162_ROUND__((LTC4162_NTC_CODE(r1) - LTC4162_NTC_CODE(r0)) * 65536 / (((t1) - (t0)) * 1000.0)) \
+  }
+
+  /*! A thermistor curve: count breakpoints in PROGMEM, sorted by rising temperature. */
+  typedef struct
+  {
+    const LTC4162_ntc_point_t *points; //!< Breakpoint table in PROGMEM
+    uint8_t count;                     //!< Number of breakpoints, at least 2
+  } LTC4162_ntc_curve_t;
+
+  /*! Vishay NTCS0402E3103FLT curve, the one the LTC4162_NTCS0402E3103FLT macros describe. */
+  extern const LTC4162_ntc_curve_t LTC4162_ntcs0402e3103flt;
+
+  /*! Converts a thermistor_voltage reading to millidegrees Celsius. */
+  int32_t LTC4162_ntc_i2fix(const LTC4162_ntc_curve_t *curve, //!< Thermistor curve, e.g. &LTC4162_ntcs0402e3103flt
+                            int16_t code                      //!< thermistor_voltage reading or alert limit
+                           );
+  /*! Converts millidegrees Celsius to the thermistor_voltage reading, e.g. for the JEITA and alert limit registers. */
+  int16_t LTC4162_ntc_fix2i(const LTC4162_ntc_curve_t *curve, //!< Thermistor curve, e.g. &LTC4162_ntcs0402e3103flt
+                            int32_t mdegc                     //!< Temperature in millidegrees Celsius
+                           );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LTC4162_NTC_H_ */
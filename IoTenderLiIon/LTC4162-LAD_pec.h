@@ -94,6 +94,12 @@ extern "C" {
 //Uncomment following line to switch from bitwise runtime computation to table lookup.
 //#define LTC4162_CRC_TABLE
 
+//Uncomment following line to have pec_block() fold 4 or 8 bytes per step through slicing tables. Implies LTC4162_CRC_TABLE.
+//#define LTC4162_CRC_SLICE 8
+#if defined(LTC4162_CRC_SLICE) && !defined(LTC4162_CRC_TABLE)
+#define LTC4162_CRC_TABLE
+#endif
+
   /*! Computes CRC-8 using x^8 + X^2 + X + 1 polynomial with most-significant-bit first endianness.
    *  SMBUs computes the PEC over all bytes of the transaction with initialization value 0 and no
    *  pre or post XOR operations.
@@ -148,6 +154,41 @@ extern "C" {
                              uint8_t pec           //!< Packet error check byte read from slave
                             );
 
+  /*! Computes CRC-8 over a block of bytes, such as a whole captured SMBus frame, continuing from remainder crc.
+   *  Running it over a frame including its PEC byte returns 0 for no errors.
+   *
+   *  Table storage by build option. The ESP8266 core copies const data to RAM at boot, so there it costs RAM as well as flash.
+   *  | Option                 | Table bytes | Bytes per step |
+   *  |:-----------------------|------------:|---------------:|
+   *  | (none, bit-wise)       |           0 |              1 |
+   *  | LTC4162_CRC_TABLE      |         256 |              1 |
+   *  | LTC4162_CRC_SLICE 4    |        1024 |              4 |
+   *  | LTC4162_CRC_SLICE 8    |        2048 |              8 |
+   */
+  uint8_t pec_block(const uint8_t *data, //!< Bytes over which to compute the CRC, in bus order
+                    size_t length,       //!< Number of bytes
+                    uint8_t crc          //!< Previous remainder, or 0 at the start of a transaction
+                   );
+
+  /*! Fills prefix[command_code] with the CRC-8 remainder after the address, command code and repeated start
+   *  address bytes of a read from address, for every command code. Done once at initialization, it leaves
+   *  only the data bytes for @ref pec_read_word_prefixed to fold in.
+   */
+  void pec_read_prefix_init(uint8_t prefix[256], //!< Table to fill, one entry per command code
+                            uint8_t address      //!< 7-bit SMBus slave address
+                           );
+
+  /*! Computes expected Packet Error Check byte from read_word transaction, starting from a prefix table built by
+   *  @ref pec_read_prefix_init for the same address. With LTC4162_CRC_TABLE defined this costs three table lookups.
+   */
+  uint8_t pec_read_word_prefixed(const uint8_t prefix[256], //!< Prefix table for the slave address
+                                 uint8_t command_code,      //!< SMBus command code (slave memory address)
+                                 uint16_t data              //!< Data read from slave
+                                );
+
+  /*! Checks crc8 and every PEC function against known good vectors. Returns the number of mismatches, 0 for none. */
+  uint8_t pec_self_test(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,160 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-L is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters including termination algorithms as
+well as numerous system status alerts. The LTC4162-L can charge Lithium-Ion cell
+stacks as high as eight cells with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-L is
+available in an I²C adjustable version as well as 4.0V, 4.1V and 4.2V fixed
+voltage versions all with and without MPPT enabled by default. The LTC4162-L is
+available in the 28-pin 4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date: 2018-03-09 17:54:10 -0500 (Fri, 09 Mar 2018) $
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-LAD
+ *  @brief LTC4162-LAD non-blocking SMBus transaction queue.
+ *
+ *  Callers submit register reads and writes, each with an optional completion
+ *  callback, and return immediately. The transactions are carried out later, a few at a
+ *  time, by calls to @ref LTC4162_queue_service from the application's main loop so that
+ *  no single pass spends longer on the bus than the caller allows.
+ *
+ *  The queue uses only the chip's user supplied smbus_read_register and smbus_write_register
+ *  functions through @ref LTC4162_read_register and @ref LTC4162_write_register, so it
+ *  runs unchanged against real hardware or a simulated chip. Storage for the slots is
+ *  supplied by the caller; nothing is allocated.
+ */
+
+#ifndef LTC4162_QUEUE_H_
+#define LTC4162_QUEUE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "LTC4162-LAD.h"
+
+  /*! Called when a queued transaction completes. failure is the read or write function's return value,
+      data is the bit field read back (reads) or the value written (writes). */
+  typedef void (*LTC4162_queue_callback)(int failure,    //!< 0 on success, otherwise the error code from the SMBus functions
+                                         uint16_t data,  //!< Right justified bit field read, or data written
+                                         void *context   //!< Context pointer given when the transaction was submitted
+                                        );
+
+  /*! One pending transaction. */
+  typedef struct
+  {
+    uint16_t registerinfo;           //!< Bit field name from LTC4162_regdefs.h
+    uint16_t data;                   //!< Data to be written, unused for reads
+    uint8_t write;                   //!< Non-zero for a write, zero for a read
+    uint8_t policy;                  //!< LTC4162_write_policy_t of a write
+    LTC4162_queue_callback callback; //!< Completion function, or NULL
+    void *context;                   //!< Passed to callback unchanged
+  } LTC4162_transaction_t;
+
+  /*! Bounded first-in first-out transaction queue over caller supplied slots. */
+  typedef struct
+  {
+    LTC4162_chip_cfg_t *chip;      //!< Chip the transactions are carried out on
+    LTC4162_transaction_t *slots;  //!< Caller supplied array of size transactions
+    uint8_t size;                  //!< Number of slots
+    uint8_t head;                  //!< Index of the oldest pending transaction
+    uint8_t count;                 //!< Number of pending transactions
+    uint16_t rejected;             //!< Submissions refused because every slot was in use
+  } LTC4162_queue_t;
+
+  /*! Prepares an empty queue using slots[0..size-1] for storage. */
+  void LTC4162_queue_init(LTC4162_queue_t *queue,        //!< Pointer to the queue to initialize
+                          LTC4162_chip_cfg_t *chip,      //!< Pointer to chip configuration struct
+                          LTC4162_transaction_t *slots,  //!< Storage for pending transactions
+                          uint8_t size                   //!< Number of entries in slots
+                         );
+  /*! Queues a bit field read. Returns 0 on success, non-zero if the queue is full. */
+  int LTC4162_queue_read(LTC4162_queue_t *queue,          //!< Pointer to the queue
+                         uint16_t registerinfo,           //!< Bit field name from LTC4162_regdefs.h
+                         LTC4162_queue_callback callback, //!< Completion function receiving the data read, or NULL
+                         void *context                    //!< Passed to callback unchanged
+                        );
+  /*! Queues a bit field write. Returns 0 on success, non-zero if the queue is full. */
+  int LTC4162_queue_write(LTC4162_queue_t *queue,          //!< Pointer to the queue
+                          uint16_t registerinfo,           //!< Bit field name from LTC4162_regdefs.h
+                          uint16_t data,                   //!< Data to be written
+                          LTC4162_queue_callback callback, //!< Completion function, or NULL
+                          void *context                    //!< Passed to callback unchanged
+                         );
+  /*! Queues a bit field write carried out by @ref LTC4162_write_register_policy. The callback receives LTC4162_VERIFY_FAILED
+      if a read back does not match. Returns 0 on success, non-zero if the queue is full. */
+  int LTC4162_queue_write_policy(LTC4162_queue_t *queue,          //!< Pointer to the queue
+                                 uint16_t registerinfo,           //!< Bit field name from LTC4162_regdefs.h
+                                 uint16_t data,                   //!< Data to be written
+                                 LTC4162_write_policy_t policy,   //!< Whether to read the register back
+                                 LTC4162_queue_callback callback, //!< Completion function, or NULL
+                                 void *context                    //!< Passed to callback unchanged
+                                );
+  /*! Carries out up to max_transactions pending transactions in submission order, calling each one's callback.
+      Returns the number carried out. */
+  uint8_t LTC4162_queue_service(LTC4162_queue_t *queue,  //!< Pointer to the queue
+                                uint8_t max_transactions //!< Most transactions to carry out in this call
+                               );
+  /*! Returns the number of transactions waiting to be carried out. */
+  uint8_t LTC4162_queue_pending(const LTC4162_queue_t *queue //!< Pointer to the queue
+                               );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LTC4162_QUEUE_H_ */
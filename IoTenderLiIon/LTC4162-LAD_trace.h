@@ -0,0 +1,118 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-L is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters including termination algorithms as
+well as numerous system status alerts. The LTC4162-L can charge Lithium-Ion cell
+stacks as high as eight cells with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-L is
+available in an I²C adjustable version as well as 4.0V, 4.1V and 4.2V fixed
+voltage versions all with and without MPPT enabled by default. The LTC4162-L is
+available in the 28-pin 4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date: 2018-03-09 17:54:10 -0500 (Fri, 09 Mar 2018) $
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-LAD
+ *  @brief LTC4162-LAD offline PEC verification of captured SMBus word transactions.
+ *
+ *  Checks the PEC byte of read_word and write_word frames pulled from bus captures, in bulk.
+ *  Each frame is treated as one polynomial over GF(2) and reduced modulo the CRC-8 polynomial
+ *  0x107; a correct frame, PEC included, leaves no remainder. On x86 processors with PCLMULQDQ
+ *  the reduction is a Barrett reduction of two carry-less multiplies per frame, chosen at run time.
+ *  Elsewhere, or when disabled with @ref LTC4162_trace_clmul, frames go through pec_block(),
+ *  which is table driven when LTC4162-LAD_pec.c is built with LTC4162_CRC_TABLE or LTC4162_CRC_SLICE.
+ *
+ *  Host tools only, never compiled in the Arduino environment.
+ */
+
+#ifndef LTC4162_TRACE_H_
+#define LTC4162_TRACE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+  /*! One captured SMBus word transaction. */
+  typedef struct
+  {
+    uint8_t address;      //!< 7-bit SMBus slave address
+    uint8_t command_code; //!< SMBus command code
+    uint16_t data;        //!< Data word as transferred, low byte first on the bus
+    uint8_t pec;          //!< PEC byte as captured
+    uint8_t read;         //!< 1 for read_word, with its repeated start address byte; 0 for write_word
+  } LTC4162_trace_frame_t;
+
+  /*! Verifies count frames. Returns the number with a bad PEC. If failures is not NULL, failures[i] is set to 1 for
+   *  each bad frame and 0 for each good one.
+   */
+  size_t LTC4162_trace_verify(const LTC4162_trace_frame_t *frames, //!< Captured frames
+                              size_t count,                        //!< Number of frames
+                              uint8_t *failures                    //!< Per frame result, or NULL
+                             );
+
+  /*! Enables (1) or disables (0) the carry-less multiply path. Returns 1 if it is in use afterwards, which requires
+   *  processor support. It is enabled by default when supported.
+   */
+  int LTC4162_trace_clmul(int enable //!< 1 to use PCLMULQDQ when available, 0 to force pec_block()
+                         );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LTC4162_TRACE_H_ */
@@ -0,0 +1,141 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-L is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters including termination algorithms as
+well as numerous system status alerts. The LTC4162-L can charge Lithium-Ion cell
+stacks as high as eight cells with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-L is
+available in an I²C adjustable version as well as 4.0V, 4.1V and 4.2V fixed
+voltage versions all with and without MPPT enabled by default. The LTC4162-L is
+available in the 28-pin 4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date: 2018-03-09 17:54:10 -0500 (Fri, 09 Mar 2018) $
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-LAD
+ *  @brief LTC4162-LAD exception polling through the alert limit registers.
+ *
+ *  Instead of reading every telemetry channel on each pass, the alert limits (0x01-0x0C) are set a hysteresis either
+ *  side of the last reading of their channel and only LIMIT_ALERTS_REG is polled: one read while nothing moves. A
+ *  channel whose window trips is read again on its own and its limits are moved to centre on the new reading.
+ *
+ *  IIN, IBAT, die temperature and BSR have a limit on one side only, so a move the other way is not seen until the
+ *  next @ref LTC4162_window_arm. Neither are the charger state, status or timers, which have no limits at all. Take a
+ *  full snapshot with @ref LTC4162_read_telemetry now and then and arm the windows around it.
+ *
+ *  The windows own the limit registers and their bits of EN_LIMIT_ALERTS_REG and LIMIT_ALERTS_REG. Whatever else
+ *  clears limit alerts, such as an SMBALERT handler, takes the trips from under the poll.
+ */
+
+#ifndef LTC4162_WINDOW_H_
+#define LTC4162_WINDOW_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "LTC4162-LAD.h"
+
+  /*! Telemetry channels with alert limits, the index into @ref LTC4162_window_t::hysteresis. */
+  typedef enum
+  {
+    LTC4162_WINDOW_VBAT,                  //!< VBAT_LO_ALERT_LIMIT and VBAT_HI_ALERT_LIMIT
+    LTC4162_WINDOW_VIN,                   //!< VIN_LO_ALERT_LIMIT and VIN_HI_ALERT_LIMIT
+    LTC4162_WINDOW_VOUT,                  //!< VOUT_LO_ALERT_LIMIT and VOUT_HI_ALERT_LIMIT
+    LTC4162_WINDOW_IIN,                   //!< IIN_HI_ALERT_LIMIT only
+    LTC4162_WINDOW_IBAT,                  //!< IBAT_LO_ALERT_LIMIT only
+    LTC4162_WINDOW_DIE_TEMP,              //!< DIE_TEMP_HI_ALERT_LIMIT only
+    LTC4162_WINDOW_BSR,                   //!< BSR_HI_ALERT_LIMIT only
+    LTC4162_WINDOW_THERMISTOR_VOLTAGE,    //!< THERMISTOR_VOLTAGE_LO_ALERT_LIMIT and THERMISTOR_VOLTAGE_HI_ALERT_LIMIT
+    LTC4162_WINDOW_CHANNELS
+  } LTC4162_window_channel_t;
+
+  /*! Hysteresis windows and poll counters. */
+  typedef struct
+  {
+    uint16_t hysteresis[LTC4162_WINDOW_CHANNELS]; //!< Distance from a reading to its limits in A/D codes. 0 leaves the channel's alerts disabled.
+    uint16_t armed;       //!< LIMIT_ALERTS_REG bits enabled by the last @ref LTC4162_window_arm
+    uint16_t tripped;     //!< LIMIT_ALERTS_REG bits serviced by the last @ref LTC4162_window_poll, 0 if nothing moved
+    uint32_t polls;       //!< Reads of LIMIT_ALERTS_REG
+    uint32_t trips;       //!< Polls that found an armed alert set
+    uint32_t rereads;     //!< Channels read again after their window tripped
+  } LTC4162_window_t;
+
+  /*! Sets the hysteresis of each channel and zeroes the counters. Nothing is written to the LTC4162 until
+      @ref LTC4162_window_arm. */
+  void LTC4162_window_init(LTC4162_window_t *window,                           //!< Pointer to the windows to initialize
+                           const uint16_t hysteresis[LTC4162_WINDOW_CHANNELS]  //!< A/D codes per channel, in @ref LTC4162_window_channel_t order
+                          );
+  /*! Sets every limit around the readings in telemetry, enables the alerts of the channels with a hysteresis and
+      clears any left over from earlier windows. A reading still outside its new window trips again at the next
+      conversion. Returns 0 on success. */
+  int LTC4162_window_arm(LTC4162_window_t *window,                 //!< Pointer to the windows
+                         LTC4162_chip_cfg_t *chip,                 //!< Pointer to chip configuration struct
+                         const LTC4162_telemetry_t *telemetry      //!< Fresh snapshot from @ref LTC4162_read_telemetry
+                        );
+  /*! Reads LIMIT_ALERTS_REG and, only if an armed alert is set, reads each tripped channel into telemetry, centres its
+      window on the new reading and clears the alerts serviced. telemetry->timestamp is set only when a channel was
+      read. window->tripped tells which alerts were serviced. Returns 0 on success. */
+  int LTC4162_window_poll(LTC4162_window_t *window,            //!< Pointer to the windows, armed by @ref LTC4162_window_arm
+                          LTC4162_chip_cfg_t *chip,            //!< Pointer to chip configuration struct
+                          LTC4162_telemetry_t *telemetry,      //!< Snapshot to bring up to date
+                          uint32_t timestamp                   //!< Time stamp for the snapshot, e.g. millis()
+                         );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LTC4162_WINDOW_H_ */
@@ -0,0 +1,267 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-S is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters as well as numerous system status
+alerts. The LTC4162-S can charge from one to four 6V Lead-Acid batteries or one
+to two 12V Lead-Acid batteries with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-S is
+available in an I²C adjustable version as well a fixed voltage version both with
+and without MPPT enabled by default. The LTC4162-S is available in the 28-pin
+4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date$
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-SAD
+ *  @brief LTC4162-SAD bulk conversion of logged telemetry for host tools.
+ */
+
+#ifndef ARDUINO
+
+#include "LTC4162-SAD_bulk.h"
+#include "LTC4162-SAD_formats.h"
+#include "LTC4162-SAD_ntc.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define BULK_AVX2
+#include <immintrin.h>
+#endif
+
+/* Thermistor breakpoints in order of rising temperature, as in LTC4162_NTCS0402E3103FLT_I2R. */
+static const struct
+{
+  double degc;
+  double ohms;
+} ntc_breakpoints[] =
+{
+  {-40, LTC4162_Rm40}, {-34, LTC4162_Rm34}, {-28, LTC4162_Rm28}, {-21, LTC4162_Rm21}, {-14, LTC4162_Rm14},
+  {-6, LTC4162_Rm6}, {4, LTC4162_R4}, {33, LTC4162_R33}, {44, LTC4162_R44}, {53, LTC4162_R53},
+  {62, LTC4162_R62}, {70, LTC4162_R70}, {78, LTC4162_R78}, {86, LTC4162_R86}, {94, LTC4162_R94},
+  {102, LTC4162_R102}, {110, LTC4162_R110}, {118, LTC4162_R118}, {126, LTC4162_R126}, {134, LTC4162_R134},
+  {142, LTC4162_R142}, {150, LTC4162_R150},
+};
+#define NTC_SEGMENTS (sizeof(ntc_breakpoints) / sizeof(ntc_breakpoints[0]) - 1)
+
+/* Per channel out = offset + gain * raw, taken from the formats macros themselves. */
+static float gain[LTC4162_BULK_CHANNELS];
+static float offset[LTC4162_BULK_CHANNELS];
+/* Thermistor segment n runs from code ntc_code[n] down to ntc_code[n + 1]; out = ntc_offset[n] + ntc_gain[n] * raw. */
+static float ntc_code[NTC_SEGMENTS + 1];
+static float ntc_gain[NTC_SEGMENTS];
+static float ntc_offset[NTC_SEGMENTS];
+/* Segment of the highest code in each run of 64. No segment is narrower than 64 codes, so a reading lies in that
+   segment or the next one. The last entry of ntc_next is a code nothing is below. */
+#define NTC_BUCKET_SHIFT 6
+static int32_t ntc_bucket[65536 >> NTC_BUCKET_SHIFT];
+static float ntc_next[NTC_SEGMENTS];
+static int initialized = 0;
+
+static void initialize(void)
+{
+  size_t n;
+#define LINEAR(channel, I2R) \
+  offset[channel] = (float)I2R(0); \
+  gain[channel] = (float)(I2R(1) - I2R(0));
+  LINEAR(LTC4162_BULK_VBAT, LTC4162_VBAT_SLA_FORMAT_I2R)
+  LINEAR(LTC4162_BULK_IBAT, LTC4162_IBAT_FORMAT_I2R)
+  LINEAR(LTC4162_BULK_VOUT, LTC4162_VOUT_FORMAT_I2R)
+  LINEAR(LTC4162_BULK_VIN, LTC4162_VIN_FORMAT_I2R)
+  LINEAR(LTC4162_BULK_IIN, LTC4162_IIN_FORMAT_I2R)
+  LINEAR(LTC4162_BULK_DIE_TEMP, LTC4162_DIE_TEMP_FORMAT_I2R)
+  LINEAR(LTC4162_BULK_BSR, LTC4162_BSR_FORMAT_SLA_U2R)
+#undef LINEAR
+  for (n = 0; n <= NTC_SEGMENTS; n++) ntc_code[n] = (float)LTC4162_NTC_CODE(ntc_breakpoints[n].ohms);
+  for (n = 0; n < NTC_SEGMENTS; n++)
+  {
+    double code0 = LTC4162_NTC_CODE(ntc_breakpoints[n].ohms);
+    double code1 = LTC4162_NTC_CODE(ntc_breakpoints[n + 1].ohms);
+    double slope = (ntc_breakpoints[n + 1].degc - ntc_breakpoints[n].degc) / (code1 - code0);
+    ntc_gain[n] = (float)slope;
+    ntc_offset[n] = (float)(ntc_breakpoints[n].degc - slope * code0);
+  }
+  for (n = 0; n < NTC_SEGMENTS; n++) ntc_next[n] = n + 1 < NTC_SEGMENTS ? ntc_code[n + 1] : -32769.0f;
+  for (n = 0; n < sizeof(ntc_bucket) / sizeof(ntc_bucket[0]); n++)
+  {
+    float highest = (float)((long)((n + 1) << NTC_BUCKET_SHIFT) - 32769);
+    size_t segment = 0;
+    while (segment + 1 < NTC_SEGMENTS && highest < ntc_code[segment + 1]) segment++;
+    ntc_bucket[n] = (int32_t)segment;
+  }
+  initialized = 1;
+}
+
+/* Thermistor segment for a reading, the first or last beyond the table. Codes fall as temperature rises. */
+static inline size_t ntc_segment(int16_t code)
+{
+  size_t segment = ntc_bucket[(uint16_t)(code + 32768) >> NTC_BUCKET_SHIFT];
+  return segment + (code < ntc_next[segment]);
+}
+
+/* Samples per block of the scalar loops. A fixed trip count lets the compiler vectorize the linear channels at -O2. */
+#define BLOCK 16
+
+static void convert_scalar(LTC4162_bulk_channel_t channel, const int16_t *raw, float *out, size_t count, float scale)
+{
+  size_t i = 0, j;
+  const float channel_offset = offset[channel] * scale;
+  const float channel_gain = gain[channel] * scale;
+  if (channel == LTC4162_BULK_THERMISTOR)
+  {
+    for (; i < count; i++)
+    {
+      size_t n = ntc_segment(raw[i]);
+      out[i] = ntc_offset[n] + ntc_gain[n] * raw[i];
+    }
+  }
+  else if (channel == LTC4162_BULK_BSR)
+  {
+    for (; i + BLOCK <= count; i += BLOCK)
+    {
+      for (j = 0; j < BLOCK; j++) out[i + j] = channel_offset + channel_gain * (uint16_t)raw[i + j];
+    }
+    for (; i < count; i++) out[i] = channel_offset + channel_gain * (uint16_t)raw[i];
+  }
+  else
+  {
+    for (; i + BLOCK <= count; i += BLOCK)
+    {
+      for (j = 0; j < BLOCK; j++) out[i + j] = channel_offset + channel_gain * raw[i + j];
+    }
+    for (; i < count; i++) out[i] = channel_offset + channel_gain * raw[i];
+  }
+}
+
+#ifdef BULK_AVX2
+
+__attribute__((target("avx2")))
+static void convert_avx2(LTC4162_bulk_channel_t channel, const int16_t *raw, float *out, size_t count, float scale)
+{
+  size_t i = 0;
+  if (channel == LTC4162_BULK_THERMISTOR)
+  {
+    /* The segment as ntc_segment finds it, with gathers in place of the table lookups, then gathered slope and offset. */
+    for (; i + 8 <= count; i += 8)
+    {
+      __m256i codes = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(raw + i)));
+      __m256 code = _mm256_cvtepi32_ps(codes);
+      __m256i bucket = _mm256_srli_epi32(_mm256_add_epi32(codes, _mm256_set1_epi32(32768)), NTC_BUCKET_SHIFT);
+      __m256i segment = _mm256_i32gather_epi32((const int *)ntc_bucket, bucket, 4);
+      __m256 next = _mm256_i32gather_ps(ntc_next, segment, 4);
+      segment = _mm256_sub_epi32(segment, _mm256_castps_si256(_mm256_cmp_ps(code, next, _CMP_LT_OQ)));
+      __m256 result = _mm256_add_ps(_mm256_i32gather_ps(ntc_offset, segment, 4),
+                                    _mm256_mul_ps(_mm256_i32gather_ps(ntc_gain, segment, 4), code));
+      _mm256_storeu_ps(out + i, result);
+    }
+  }
+  else
+  {
+    __m256 channel_offset = _mm256_set1_ps(offset[channel] * scale);
+    __m256 channel_gain = _mm256_set1_ps(gain[channel] * scale);
+    if (channel == LTC4162_BULK_BSR)
+    {
+      for (; i + 8 <= count; i += 8)
+      {
+        __m256 code = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(raw + i))));
+        _mm256_storeu_ps(out + i, _mm256_add_ps(channel_offset, _mm256_mul_ps(channel_gain, code)));
+      }
+    }
+    else
+    {
+      for (; i + 8 <= count; i += 8)
+      {
+        __m256 code = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(raw + i))));
+        _mm256_storeu_ps(out + i, _mm256_add_ps(channel_offset, _mm256_mul_ps(channel_gain, code)));
+      }
+    }
+  }
+  _mm256_zeroupper(); // Avoid the AVX to SSE transition penalty in the scalar tail and the caller
+  convert_scalar(channel, raw + i, out + i, count - i, scale);
+}
+
+static int avx2_supported(void)
+{
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+}
+
+#endif
+
+static void (*convert)(LTC4162_bulk_channel_t, const int16_t *, float *, size_t, float) = 0;
+
+int LTC4162_bulk_avx2(int enable)
+{
+#ifdef BULK_AVX2
+  if (enable && avx2_supported())
+  {
+    convert = convert_avx2;
+    return 1;
+  }
+#else
+  (void)enable;
+#endif
+  convert = convert_scalar;
+  return 0;
+}
+
+void LTC4162_bulk_convert(LTC4162_bulk_channel_t channel, const int16_t *raw, float *out, size_t count, uint16_t cell_count)
+{
+  float scale = 1;
+  if (!initialized) initialize();
+  if (!convert) LTC4162_bulk_avx2(1);
+  if (channel == LTC4162_BULK_VBAT || channel == LTC4162_BULK_BSR) scale = cell_count / 2.0f;
+  convert(channel, raw, out, count, scale);
+}
+
+#endif /* ARDUINO */
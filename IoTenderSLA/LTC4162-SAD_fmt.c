@@ -0,0 +1,125 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-S is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters as well as numerous system status
+alerts. The LTC4162-S can charge from one to four 6V Lead-Acid batteries or one
+to two 12V Lead-Acid batteries with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-S is
+available in an I²C adjustable version as well a fixed voltage version both with
+and without MPPT enabled by default. The LTC4162-S is available in the 28-pin
+4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date$
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-SAD
+ *  @brief LTC4162-SAD fixed point text formatting.
+ */
+
+#include "LTC4162-SAD_fmt.h"
+
+static const uint32_t powers_of_ten[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+char *LTC4162_fmt_fix(char *out, int32_t value, uint8_t scale, uint8_t decimals, const char *unit)
+{
+  char digits[10];
+  uint8_t count = 0, shown, padding = 0;
+  uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+  if (decimals > 9) decimals = 9;
+  if (scale > decimals)
+  {
+    if (scale - decimals > 9)
+    {
+      magnitude = 0; // No int32_t reaches half of 10^10
+    }
+    else
+    {
+      uint32_t divisor = powers_of_ten[scale - decimals];
+      uint32_t remainder = magnitude % divisor;
+      magnitude = magnitude / divisor + (remainder >= divisor - remainder); // Half away from zero, without overflow
+    }
+    shown = decimals;
+  }
+  else
+  {
+    shown = scale;
+    padding = decimals - scale;
+  }
+  if (value < 0 && magnitude != 0) *out++ = '-';
+  do
+  {
+    digits[count++] = (char)('0' + magnitude % 10);
+    magnitude /= 10;
+  }
+  while (magnitude != 0 || count <= shown);
+  while (count > shown) *out++ = digits[--count];
+  if (decimals != 0)
+  {
+    *out++ = '.';
+    while (count != 0) *out++ = digits[--count];
+    while (padding-- != 0) *out++ = '0';
+  }
+  if (unit != 0)
+    while (*unit != '\0') *out++ = *unit++;
+  *out = '\0';
+  return out;
+}
+
+char *LTC4162_fmt_duration(char *out, uint32_t seconds)
+{
+  out = LTC4162_fmt_fix(out, (int32_t)(seconds / 3600), 0, 0, "h ");
+  out = LTC4162_fmt_fix(out, (int32_t)(seconds % 3600 / 60), 0, 0, "m ");
+  return LTC4162_fmt_fix(out, (int32_t)(seconds % 60), 0, 0, "s");
+}
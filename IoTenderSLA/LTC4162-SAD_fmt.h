@@ -0,0 +1,108 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-S is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters as well as numerous system status
+alerts. The LTC4162-S can charge from one to four 6V Lead-Acid batteries or one
+to two 12V Lead-Acid batteries with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-S is
+available in an I²C adjustable version as well a fixed voltage version both with
+and without MPPT enabled by default. The LTC4162-S is available in the 28-pin
+4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date$
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-SAD
+ *  @brief LTC4162-SAD fixed point text formatting.
+ *
+ *  Formats the integer results of the _I2FIX/_U2FIX macros and @ref LTC4162_ntc_i2fix as decimal text with a unit,
+ *  without floating point, printf or heap allocation, for web pages and machine readable reports alike. Each function
+ *  writes into a caller supplied buffer and returns a pointer to the terminating NUL, so that fields can be appended
+ *  one after another without measuring the string so far.
+ */
+
+#ifndef LTC4162_FMT_H_
+#define LTC4162_FMT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+  /*! Buffer size for any @ref LTC4162_fmt_fix or @ref LTC4162_fmt_duration result, not counting the unit. */
+#define LTC4162_FMT_SIZE 24
+
+  /*! Writes value / 10^scale rounded to decimals places, half away from zero, followed by unit. A value of 3700 at
+   *  scale 3 is "3.700" with 3 decimals and "3.7" with 1. Any scale more than 9 above decimals shows zero, which every
+   *  int32_t rounds to. Returns a pointer to the terminating NUL.
+   */
+  char *LTC4162_fmt_fix(char *out,          //!< Destination, at least LTC4162_FMT_SIZE bytes plus the unit
+                        int32_t value,      //!< Fixed point value, for example millivolts from an _I2FIX macro
+                        uint8_t scale,      //!< Decimal places in value, 3 for millivolts, 6 for microohms
+                        uint8_t decimals,   //!< Decimal places to show, 0 to 9
+                        const char *unit    //!< Text to follow the number, or NULL for none
+                       );
+
+  /*! Writes seconds as "Hh Mm Ss", as the charge timers are shown. Returns a pointer to the terminating NUL. */
+  char *LTC4162_fmt_duration(char *out,       //!< Destination, at least LTC4162_FMT_SIZE bytes
+                             uint32_t seconds //!< Duration to write
+                            );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LTC4162_FMT_H_ */
@@ -0,0 +1,134 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-S is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters as well as numerous system status
+alerts. The LTC4162-S can charge from one to four 6V Lead-Acid batteries or one
+to two 12V Lead-Acid batteries with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-S is
+available in an I²C adjustable version as well a fixed voltage version both with
+and without MPPT enabled by default. The LTC4162-S is available in the 28-pin
+4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date$
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-SAD
+ *  @brief LTC4162-SAD telemetry history ring buffer.
+ */
+
+#include "LTC4162-SAD_history.h"
+
+void LTC4162_history_init(LTC4162_history_t *history, LTC4162_history_sample_t *samples, uint16_t size)
+{
+  history->samples = samples;
+  history->size = size;
+  history->head = 0;
+  history->count = 0;
+  history->first_ms = 0;
+  history->last_ms = 0;
+  history->appended = 0;
+}
+
+void LTC4162_history_append(LTC4162_history_t *history, const LTC4162_telemetry_t *telemetry)
+{
+  LTC4162_history_sample_t *sample;
+  uint32_t delta = telemetry->timestamp - history->last_ms;
+  uint16_t tail;
+  if (history->size == 0) return;
+  if (history->count == 0) delta = 0;
+  tail = history->head + history->count;
+  if (tail >= history->size) tail -= history->size;
+  if (history->count == history->size)
+  {
+    if (++history->head == history->size) history->head = 0;    // The oldest is overwritten, the next oldest takes its place
+    history->first_ms += history->samples[history->head].delta_ms;
+  }
+  else
+    history->count++;
+  sample = &history->samples[tail];
+  sample->delta_ms = delta < LTC4162_HISTORY_DELTA_MAX ? (uint16_t)delta : LTC4162_HISTORY_DELTA_MAX;
+  sample->vbat = (int16_t)telemetry->vbat;
+  sample->vin = (int16_t)telemetry->vin;
+  sample->vout = (int16_t)telemetry->vout;
+  sample->ibat = (int16_t)telemetry->ibat;
+  sample->iin = (int16_t)telemetry->iin;
+  sample->die_temp = (int16_t)telemetry->die_temp;
+  sample->thermistor_voltage = (int16_t)telemetry->thermistor_voltage;
+  sample->charger_state = telemetry->charger_state;
+  sample->status = (uint16_t)(telemetry->system_status & LTC4162_HISTORY_SYSTEM_STATUS_MASK) |
+                   (uint16_t)(telemetry->charge_status << LTC4162_HISTORY_CHARGE_STATUS_OFFSET);
+  if (history->count == 1) history->first_ms = telemetry->timestamp;
+  history->last_ms = telemetry->timestamp;
+  history->appended++;
+}
+
+void LTC4162_history_iter(const LTC4162_history_t *history, LTC4162_history_iter_t *iter)
+{
+  iter->history = history;
+  iter->index = history->head;
+  iter->remaining = history->count;
+  iter->time_ms = history->count ? history->first_ms - history->samples[history->head].delta_ms : 0;   // The first next() adds it back
+}
+
+const LTC4162_history_sample_t *LTC4162_history_next(LTC4162_history_iter_t *iter)
+{
+  const LTC4162_history_sample_t *sample;
+  if (iter->remaining == 0) return NULL;
+  sample = &iter->history->samples[iter->index];
+  iter->time_ms += sample->delta_ms;
+  if (++iter->index == iter->history->size) iter->index = 0;
+  iter->remaining--;
+  return sample;
+}
@@ -0,0 +1,157 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-S is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters as well as numerous system status
+alerts. The LTC4162-S can charge from one to four 6V Lead-Acid batteries or one
+to two 12V Lead-Acid batteries with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-S is
+available in an I²C adjustable version as well a fixed voltage version both with
+and without MPPT enabled by default. The LTC4162-S is available in the 28-pin
+4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date$
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-SAD
+ *  @brief LTC4162-SAD telemetry history ring buffer.
+ *
+ *  Keeps recent telemetry snapshots as packed raw register codes, 20 bytes a sample, so that hours of history fit in
+ *  the RAM a handful of formatted strings would take. Each sample holds the time since the previous one, the seven
+ *  measurement codes, the charger state and the charge and system status bits. Scale codes with the
+ *  LTC4162-SAD_formats.h macros only when they are shown.
+ *
+ *  Appending is O(1) and never allocates; once the caller supplied storage is full the oldest sample is overwritten.
+ *  Readers walk the samples oldest first with an iterator that returns pointers into the buffer rather than copies.
+ *  The buffer has no locking: append and read from the same thread, as the main loop's tasks do.
+ */
+
+#ifndef LTC4162_HISTORY_H_
+#define LTC4162_HISTORY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "LTC4162-SAD.h"
+
+#define LTC4162_HISTORY_SYSTEM_STATUS_MASK 0x01FF    //!< SYSTEM_STATUS_REG bits kept in the low bits of status
+#define LTC4162_HISTORY_CHARGE_STATUS_OFFSET 10      //!< CHARGE_STATUS_REG bits kept in the top bits of status
+#define LTC4162_HISTORY_DELTA_MAX 65535              //!< delta_ms of a sample taken this long or longer after the previous one
+
+/*! SYSTEM_STATUS_REG of a sample, for the SYSTEM_STATUS _DECODE macros. */
+#define LTC4162_HISTORY_SYSTEM_STATUS(sample) ((uint16_t)((sample)->status & LTC4162_HISTORY_SYSTEM_STATUS_MASK))
+/*! CHARGE_STATUS_REG of a sample, for the CHARGE_STATUS _DECODE macros. */
+#define LTC4162_HISTORY_CHARGE_STATUS(sample) ((uint16_t)((sample)->status >> LTC4162_HISTORY_CHARGE_STATUS_OFFSET))
+
+  /*! One telemetry snapshot, 20 bytes with no padding. */
+  typedef struct
+  {
+    uint16_t delta_ms;            //!< Time since the previous sample, saturating at LTC4162_HISTORY_DELTA_MAX
+    int16_t vbat;                 //!< VBAT_REG code
+    int16_t vin;                  //!< VIN_REG code
+    int16_t vout;                 //!< VOUT_REG code
+    int16_t ibat;                 //!< IBAT_REG code
+    int16_t iin;                  //!< IIN_REG code
+    int16_t die_temp;             //!< DIE_TEMP_REG code
+    int16_t thermistor_voltage;   //!< THERMISTOR_VOLTAGE_REG code
+    uint16_t charger_state;       //!< CHARGER_STATE_REG
+    uint16_t status;              //!< CHARGE_STATUS_REG and SYSTEM_STATUS_REG, see @ref LTC4162_HISTORY_CHARGE_STATUS
+  } LTC4162_history_sample_t;
+
+  /*! Ring of samples over caller supplied storage. */
+  typedef struct
+  {
+    LTC4162_history_sample_t *samples;  //!< Caller supplied array of size samples
+    uint16_t size;                      //!< Number of samples the storage holds
+    uint16_t head;                      //!< Index of the oldest sample
+    uint16_t count;                     //!< Number of samples held
+    uint32_t first_ms;                  //!< Time stamp of the oldest sample
+    uint32_t last_ms;                   //!< Time stamp of the newest sample
+    uint32_t appended;                  //!< Samples appended since initialization, including those since overwritten
+  } LTC4162_history_t;
+
+  /*! Position of a walk through the history, oldest sample first. */
+  typedef struct
+  {
+    const LTC4162_history_t *history;   //!< History being read
+    uint16_t index;                     //!< Index of the next sample to return
+    uint16_t remaining;                 //!< Samples not yet returned
+    uint32_t time_ms;                   //!< Time stamp of the sample last returned
+  } LTC4162_history_iter_t;
+
+  /*! Prepares an empty history using samples[0..size-1] for storage. */
+  void LTC4162_history_init(LTC4162_history_t *history,          //!< Pointer to the history to initialize
+                            LTC4162_history_sample_t *samples,   //!< Storage for the samples
+                            uint16_t size                        //!< Number of entries in samples
+                           );
+  /*! Packs a snapshot into the next sample, overwriting the oldest if the history is full. The snapshot's timestamp
+      should not be earlier than the last one appended. */
+  void LTC4162_history_append(LTC4162_history_t *history,            //!< Pointer to the history
+                              const LTC4162_telemetry_t *telemetry   //!< Snapshot from @ref LTC4162_read_telemetry
+                             );
+  /*! Starts a walk at the oldest sample. Appending during the walk invalidates it. */
+  void LTC4162_history_iter(const LTC4162_history_t *history,   //!< Pointer to the history
+                            LTC4162_history_iter_t *iter        //!< Iterator to position
+                           );
+  /*! Returns the next sample, in place in the history, and sets iter->time_ms to its time stamp. Returns NULL after
+      the newest sample. */
+  const LTC4162_history_sample_t *LTC4162_history_next(LTC4162_history_iter_t *iter //!< Iterator from @ref LTC4162_history_iter
+                                                      );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LTC4162_HISTORY_H_ */
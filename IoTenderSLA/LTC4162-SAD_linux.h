@@ -0,0 +1,141 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-S is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters as well as numerous system status
+alerts. The LTC4162-S can charge from one to four 6V Lead-Acid batteries or one
+to two 12V Lead-Acid batteries with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-S is
+available in an I²C adjustable version as well a fixed voltage version both with
+and without MPPT enabled by default. The LTC4162-S is available in the 28-pin
+4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date$
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-SAD
+ *  @brief LTC4162-SAD Linux i2c-dev SMBus port.
+ *
+ *  smbus_read_register, smbus_write_register and smbus_read_register_list implementations
+ *  for the Linux i2c-dev interface, e.g. /dev/i2c-1 on a Raspberry Pi or BeagleBone.
+ *
+ *  Every transaction is issued with the I2C_RDWR ioctl so that the PEC byte is transferred
+ *  and checked in user space, independent of adapter PEC support. A register list becomes one
+ *  ioctl carrying a write and a read message per register, joined by repeated starts, so a
+ *  whole telemetry sweep costs a couple of system calls instead of one or more per register.
+ *
+ *  Concurrent processes are kept apart with the flock(2) advisory lock described in
+ *  @ref LTC4162_write_register. Each transaction or list holds it for its duration;
+ *  LTC4162_linux_lock() and LTC4162_linux_unlock() extend it over a sequence of calls,
+ *  such as a bit field read-modify-write.
+ *
+ *  Only compiled for Linux hosts, never in the Arduino environment.
+ */
+
+#ifndef LTC4162_LINUX_H_
+#define LTC4162_LINUX_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "LTC4162-SAD.h"
+
+  /*! Linux specific port information passed to the functions below through @ref LTC4162_chip_cfg_t. */
+  struct port_configuration
+  {
+    int file_descriptor; //!< Open i2c-dev device
+    int lock_depth;      //!< Nesting count of LTC4162_linux_lock() and internal locking
+  };
+
+  /*! Opens an i2c-dev device such as "/dev/i2c-1". Returns 0 on success or an errno value. */
+  int LTC4162_linux_open(struct port_configuration *pc, //!< Port to initialize
+                         const char *device             //!< Path of the i2c-dev device node
+                        );
+  /*! Closes the device opened by @ref LTC4162_linux_open. */
+  void LTC4162_linux_close(struct port_configuration *pc //!< Port to close
+                          );
+  /*! Takes the exclusive advisory lock on the device, or deepens the hold on it. Returns 0 on success or an errno value. */
+  int LTC4162_linux_lock(struct port_configuration *pc //!< Port to lock
+                        );
+  /*! Releases one level of the lock taken by @ref LTC4162_linux_lock. Returns 0 on success or an errno value. */
+  int LTC4162_linux_unlock(struct port_configuration *pc //!< Port to unlock
+                          );
+
+  /*! smbus_read_register with PEC. Returns 0 on success, an errno value on bus failure or EBADMSG on PEC mismatch. */
+  int LTC4162_linux_read_register(uint8_t address,              //!< Target IC's 7-bit SMBus address
+                                  uint8_t command_code,         //!< Command code to be read from
+                                  uint16_t *data,               //!< Pointer to data destination
+                                  struct port_configuration *pc //!< Port opened by LTC4162_linux_open
+                                 );
+  /*! smbus_write_register with PEC. Returns 0 on success or an errno value. */
+  int LTC4162_linux_write_register(uint8_t address,              //!< Target IC's 7-bit SMBus address
+                                   uint8_t command_code,         //!< Command code to be written to
+                                   uint16_t data,                //!< Data to be written
+                                   struct port_configuration *pc //!< Port opened by LTC4162_linux_open
+                                  );
+  /*! smbus_read_register_list with PEC, batching the reads into as few I2C_RDWR calls as the kernel allows.
+      Returns 0 on success, an errno value on bus failure or EBADMSG on PEC mismatch. */
+  int LTC4162_linux_read_register_list(uint8_t address,              //!< Target IC's 7-bit SMBus address
+                                       const uint8_t *command_codes, //!< Command codes to be read from, in order
+                                       uint16_t *data,               //!< Pointer to data destination, one word per command code
+                                       uint8_t count,                //!< Number of registers to read
+                                       struct port_configuration *pc //!< Port opened by LTC4162_linux_open
+                                      );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LTC4162_LINUX_H_ */
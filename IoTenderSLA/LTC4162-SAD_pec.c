@@ -71,7 +71,7 @@ Generated on: 2018-03-09
  *  This is an implementation of the 8-bit CRC which can optionally
  *  be used for SMBus Packet Error Checking.
  *
- *  Both bit-wise and byte-wise implementations are included to trade
+ *  Bit-wise, byte-wise and slicing-by-4/8 implementations are included to trade
  *  program storage space against execution speed optimization.
  */
 
@@ -93,6 +93,295 @@ uint8_t crc8(uint8_t data, uint8_t crc)
 
 #else
 
+#ifdef LTC4162_CRC_SLICE
+
+#if LTC4162_CRC_SLICE != 4 && LTC4162_CRC_SLICE != 8
+#error LTC4162_CRC_SLICE must be 4 or 8
+#endif
+
+/* crc8_slice[k][x] is the remainder of byte x followed by k zero bytes. Row 0 is the ordinary byte-wise table. */
+static const uint8_t crc8_slice[LTC4162_CRC_SLICE][256] =
+{
+  { // 0 trailing zero bytes
+    0000, 0X07, 0X0E, 0X09, 0X1C, 0X1B, 0X12, 0X15,
+    0X38, 0X3F, 0X36, 0X31, 0X24, 0X23, 0X2A, 0X2D,
+    0X70, 0X77, 0X7E, 0X79, 0X6C, 0X6B, 0X62, 0X65,
+    0X48, 0X4F, 0X46, 0X41, 0X54, 0X53, 0X5A, 0X5D,
+    0XE0, 0XE7, 0XEE, 0XE9, 0XFC, 0XFB, 0XF2, 0XF5,
+    0XD8, 0XDF, 0XD6, 0XD1, 0XC4, 0XC3, 0XCA, 0XCD,
+    0X90, 0X97, 0X9E, 0X99, 0X8C, 0X8B, 0X82, 0X85,
+    0XA8, 0XAF, 0XA6, 0XA1, 0XB4, 0XB3, 0XBA, 0XBD,
+    0XC7, 0XC0, 0XC9, 0XCE, 0XDB, 0XDC, 0XD5, 0XD2,
+    0XFF, 0XF8, 0XF1, 0XF6, 0XE3, 0XE4, 0XED, 0XEA,
+    0XB7, 0XB0, 0XB9, 0XBE, 0XAB, 0XAC, 0XA5, 0XA2,
+    0X8F, 0X88, 0X81, 0X86, 0X93, 0X94, 0X9D, 0X9A,
+    0X27, 0X20, 0X29, 0X2E, 0X3B, 0X3C, 0X35, 0X32,
+    0X1F, 0X18, 0X11, 0X16, 0X03, 0X04, 0X0D, 0X0A,
+    0X57, 0X50, 0X59, 0X5E, 0X4B, 0X4C, 0X45, 0X42,
+    0X6F, 0X68, 0X61, 0X66, 0X73, 0X74, 0X7D, 0X7A,
+    0X89, 0X8E, 0X87, 0X80, 0X95, 0X92, 0X9B, 0X9C,
+    0XB1, 0XB6, 0XBF, 0XB8, 0XAD, 0XAA, 0XA3, 0XA4,
+    0XF9, 0XFE, 0XF7, 0XF0, 0XE5, 0XE2, 0XEB, 0XEC,
+    0XC1, 0XC6, 0XCF, 0XC8, 0XDD, 0XDA, 0XD3, 0XD4,
+    0X69, 0X6E, 0X67, 0X60, 0X75, 0X72, 0X7B, 0X7C,
+    0X51, 0X56, 0X5F, 0X58, 0X4D, 0X4A, 0X43, 0X44,
+    0X19, 0X1E, 0X17, 0X10, 0X05, 0X02, 0X0B, 0X0C,
+    0X21, 0X26, 0X2F, 0X28, 0X3D, 0X3A, 0X33, 0X34,
+    0X4E, 0X49, 0X40, 0X47, 0X52, 0X55, 0X5C, 0X5B,
+    0X76, 0X71, 0X78, 0X7F, 0X6A, 0X6D, 0X64, 0X63,
+    0X3E, 0X39, 0X30, 0X37, 0X22, 0X25, 0X2C, 0X2B,
+    0X06, 0X01, 0X08, 0X0F, 0X1A, 0X1D, 0X14, 0X13,
+    0XAE, 0XA9, 0XA0, 0XA7, 0XB2, 0XB5, 0XBC, 0XBB,
+    0X96, 0X91, 0X98, 0X9F, 0X8A, 0X8D, 0X84, 0X83,
+    0XDE, 0XD9, 0XD0, 0XD7, 0XC2, 0XC5, 0XCC, 0XCB,
+    0XE6, 0XE1, 0XE8, 0XEF, 0XFA, 0XFD, 0XF4, 0XF3
+  },
+  { // 1 trailing zero byte
+    0000, 0X15, 0X2A, 0X3F, 0X54, 0X41, 0X7E, 0X6B,
+    0XA8, 0XBD, 0X82, 0X97, 0XFC, 0XE9, 0XD6, 0XC3,
+    0X57, 0X42, 0X7D, 0X68, 0X03, 0X16, 0X29, 0X3C,
+    0XFF, 0XEA, 0XD5, 0XC0, 0XAB, 0XBE, 0X81, 0X94,
+    0XAE, 0XBB, 0X84, 0X91, 0XFA, 0XEF, 0XD0, 0XC5,
+    0X06, 0X13, 0X2C, 0X39, 0X52, 0X47, 0X78, 0X6D,
+    0XF9, 0XEC, 0XD3, 0XC6, 0XAD, 0XB8, 0X87, 0X92,
+    0X51, 0X44, 0X7B, 0X6E, 0X05, 0X10, 0X2F, 0X3A,
+    0X5B, 0X4E, 0X71, 0X64, 0X0F, 0X1A, 0X25, 0X30,
+    0XF3, 0XE6, 0XD9, 0XCC, 0XA7, 0XB2, 0X8D, 0X98,
+    0X0C, 0X19, 0X26, 0X33, 0X58, 0X4D, 0X72, 0X67,
+    0XA4, 0XB1, 0X8E, 0X9B, 0XF0, 0XE5, 0XDA, 0XCF,
+    0XF5, 0XE0, 0XDF, 0XCA, 0XA1, 0XB4, 0X8B, 0X9E,
+    0X5D, 0X48, 0X77, 0X62, 0X09, 0X1C, 0X23, 0X36,
+    0XA2, 0XB7, 0X88, 0X9D, 0XF6, 0XE3, 0XDC, 0XC9,
+    0X0A, 0X1F, 0X20, 0X35, 0X5E, 0X4B, 0X74, 0X61,
+    0XB6, 0XA3, 0X9C, 0X89, 0XE2, 0XF7, 0XC8, 0XDD,
+    0X1E, 0X0B, 0X34, 0X21, 0X4A, 0X5F, 0X60, 0X75,
+    0XE1, 0XF4, 0XCB, 0XDE, 0XB5, 0XA0, 0X9F, 0X8A,
+    0X49, 0X5C, 0X63, 0X76, 0X1D, 0X08, 0X37, 0X22,
+    0X18, 0X0D, 0X32, 0X27, 0X4C, 0X59, 0X66, 0X73,
+    0XB0, 0XA5, 0X9A, 0X8F, 0XE4, 0XF1, 0XCE, 0XDB,
+    0X4F, 0X5A, 0X65, 0X70, 0X1B, 0X0E, 0X31, 0X24,
+    0XE7, 0XF2, 0XCD, 0XD8, 0XB3, 0XA6, 0X99, 0X8C,
+    0XED, 0XF8, 0XC7, 0XD2, 0XB9, 0XAC, 0X93, 0X86,
+    0X45, 0X50, 0X6F, 0X7A, 0X11, 0X04, 0X3B, 0X2E,
+    0XBA, 0XAF, 0X90, 0X85, 0XEE, 0XFB, 0XC4, 0XD1,
+    0X12, 0X07, 0X38, 0X2D, 0X46, 0X53, 0X6C, 0X79,
+    0X43, 0X56, 0X69, 0X7C, 0X17, 0X02, 0X3D, 0X28,
+    0XEB, 0XFE, 0XC1, 0XD4, 0XBF, 0XAA, 0X95, 0X80,
+    0X14, 0X01, 0X3E, 0X2B, 0X40, 0X55, 0X6A, 0X7F,
+    0XBC, 0XA9, 0X96, 0X83, 0XE8, 0XFD, 0XC2, 0XD7
+  },
+  { // 2 trailing zero bytes
+    0000, 0X6B, 0XD6, 0XBD, 0XAB, 0XC0, 0X7D, 0X16,
+    0X51, 0X3A, 0X87, 0XEC, 0XFA, 0X91, 0X2C, 0X47,
+    0XA2, 0XC9, 0X74, 0X1F, 0X09, 0X62, 0XDF, 0XB4,
+    0XF3, 0X98, 0X25, 0X4E, 0X58, 0X33, 0X8E, 0XE5,
+    0X43, 0X28, 0X95, 0XFE, 0XE8, 0X83, 0X3E, 0X55,
+    0X12, 0X79, 0XC4, 0XAF, 0XB9, 0XD2, 0X6F, 0X04,
+    0XE1, 0X8A, 0X37, 0X5C, 0X4A, 0X21, 0X9C, 0XF7,
+    0XB0, 0XDB, 0X66, 0X0D, 0X1B, 0X70, 0XCD, 0XA6,
+    0X86, 0XED, 0X50, 0X3B, 0X2D, 0X46, 0XFB, 0X90,
+    0XD7, 0XBC, 0X01, 0X6A, 0X7C, 0X17, 0XAA, 0XC1,
+    0X24, 0X4F, 0XF2, 0X99, 0X8F, 0XE4, 0X59, 0X32,
+    0X75, 0X1E, 0XA3, 0XC8, 0XDE, 0XB5, 0X08, 0X63,
+    0XC5, 0XAE, 0X13, 0X78, 0X6E, 0X05, 0XB8, 0XD3,
+    0X94, 0XFF, 0X42, 0X29, 0X3F, 0X54, 0XE9, 0X82,
+    0X67, 0X0C, 0XB1, 0XDA, 0XCC, 0XA7, 0X1A, 0X71,
+    0X36, 0X5D, 0XE0, 0X8B, 0X9D, 0XF6, 0X4B, 0X20,
+    0X0B, 0X60, 0XDD, 0XB6, 0XA0, 0XCB, 0X76, 0X1D,
+    0X5A, 0X31, 0X8C, 0XE7, 0XF1, 0X9A, 0X27, 0X4C,
+    0XA9, 0XC2, 0X7F, 0X14, 0X02, 0X69, 0XD4, 0XBF,
+    0XF8, 0X93, 0X2E, 0X45, 0X53, 0X38, 0X85, 0XEE,
+    0X48, 0X23, 0X9E, 0XF5, 0XE3, 0X88, 0X35, 0X5E,
+    0X19, 0X72, 0XCF, 0XA4, 0XB2, 0XD9, 0X64, 0X0F,
+    0XEA, 0X81, 0X3C, 0X57, 0X41, 0X2A, 0X97, 0XFC,
+    0XBB, 0XD0, 0X6D, 0X06, 0X10, 0X7B, 0XC6, 0XAD,
+    0X8D, 0XE6, 0X5B, 0X30, 0X26, 0X4D, 0XF0, 0X9B,
+    0XDC, 0XB7, 0X0A, 0X61, 0X77, 0X1C, 0XA1, 0XCA,
+    0X2F, 0X44, 0XF9, 0X92, 0X84, 0XEF, 0X52, 0X39,
+    0X7E, 0X15, 0XA8, 0XC3, 0XD5, 0XBE, 0X03, 0X68,
+    0XCE, 0XA5, 0X18, 0X73, 0X65, 0X0E, 0XB3, 0XD8,
+    0X9F, 0XF4, 0X49, 0X22, 0X34, 0X5F, 0XE2, 0X89,
+    0X6C, 0X07, 0XBA, 0XD1, 0XC7, 0XAC, 0X11, 0X7A,
+    0X3D, 0X56, 0XEB, 0X80, 0X96, 0XFD, 0X40, 0X2B
+  },
+  { // 3 trailing zero bytes
+    0000, 0X16, 0X2C, 0X3A, 0X58, 0X4E, 0X74, 0X62,
+    0XB0, 0XA6, 0X9C, 0X8A, 0XE8, 0XFE, 0XC4, 0XD2,
+    0X67, 0X71, 0X4B, 0X5D, 0X3F, 0X29, 0X13, 0X05,
+    0XD7, 0XC1, 0XFB, 0XED, 0X8F, 0X99, 0XA3, 0XB5,
+    0XCE, 0XD8, 0XE2, 0XF4, 0X96, 0X80, 0XBA, 0XAC,
+    0X7E, 0X68, 0X52, 0X44, 0X26, 0X30, 0X0A, 0X1C,
+    0XA9, 0XBF, 0X85, 0X93, 0XF1, 0XE7, 0XDD, 0XCB,
+    0X19, 0X0F, 0X35, 0X23, 0X41, 0X57, 0X6D, 0X7B,
+    0X9B, 0X8D, 0XB7, 0XA1, 0XC3, 0XD5, 0XEF, 0XF9,
+    0X2B, 0X3D, 0X07, 0X11, 0X73, 0X65, 0X5F, 0X49,
+    0XFC, 0XEA, 0XD0, 0XC6, 0XA4, 0XB2, 0X88, 0X9E,
+    0X4C, 0X5A, 0X60, 0X76, 0X14, 0X02, 0X38, 0X2E,
+    0X55, 0X43, 0X79, 0X6F, 0X0D, 0X1B, 0X21, 0X37,
+    0XE5, 0XF3, 0XC9, 0XDF, 0XBD, 0XAB, 0X91, 0X87,
+    0X32, 0X24, 0X1E, 0X08, 0X6A, 0X7C, 0X46, 0X50,
+    0X82, 0X94, 0XAE, 0XB8, 0XDA, 0XCC, 0XF6, 0XE0,
+    0X31, 0X27, 0X1D, 0X0B, 0X69, 0X7F, 0X45, 0X53,
+    0X81, 0X97, 0XAD, 0XBB, 0XD9, 0XCF, 0XF5, 0XE3,
+    0X56, 0X40, 0X7A, 0X6C, 0X0E, 0X18, 0X22, 0X34,
+    0XE6, 0XF0, 0XCA, 0XDC, 0XBE, 0XA8, 0X92, 0X84,
+    0XFF, 0XE9, 0XD3, 0XC5, 0XA7, 0XB1, 0X8B, 0X9D,
+    0X4F, 0X59, 0X63, 0X75, 0X17, 0X01, 0X3B, 0X2D,
+    0X98, 0X8E, 0XB4, 0XA2, 0XC0, 0XD6, 0XEC, 0XFA,
+    0X28, 0X3E, 0X04, 0X12, 0X70, 0X66, 0X5C, 0X4A,
+    0XAA, 0XBC, 0X86, 0X90, 0XF2, 0XE4, 0XDE, 0XC8,
+    0X1A, 0X0C, 0X36, 0X20, 0X42, 0X54, 0X6E, 0X78,
+    0XCD, 0XDB, 0XE1, 0XF7, 0X95, 0X83, 0XB9, 0XAF,
+    0X7D, 0X6B, 0X51, 0X47, 0X25, 0X33, 0X09, 0X1F,
+    0X64, 0X72, 0X48, 0X5E, 0X3C, 0X2A, 0X10, 0X06,
+    0XD4, 0XC2, 0XF8, 0XEE, 0X8C, 0X9A, 0XA0, 0XB6,
+    0X03, 0X15, 0X2F, 0X39, 0X5B, 0X4D, 0X77, 0X61,
+    0XB3, 0XA5, 0X9F, 0X89, 0XEB, 0XFD, 0XC7, 0XD1
+  },
+#if LTC4162_CRC_SLICE == 8
+  { // 4 trailing zero bytes
+    0000, 0X62, 0XC4, 0XA6, 0X8F, 0XED, 0X4B, 0X29,
+    0X19, 0X7B, 0XDD, 0XBF, 0X96, 0XF4, 0X52, 0X30,
+    0X32, 0X50, 0XF6, 0X94, 0XBD, 0XDF, 0X79, 0X1B,
+    0X2B, 0X49, 0XEF, 0X8D, 0XA4, 0XC6, 0X60, 0X02,
+    0X64, 0X06, 0XA0, 0XC2, 0XEB, 0X89, 0X2F, 0X4D,
+    0X7D, 0X1F, 0XB9, 0XDB, 0XF2, 0X90, 0X36, 0X54,
+    0X56, 0X34, 0X92, 0XF0, 0XD9, 0XBB, 0X1D, 0X7F,
+    0X4F, 0X2D, 0X8B, 0XE9, 0XC0, 0XA2, 0X04, 0X66,
+    0XC8, 0XAA, 0X0C, 0X6E, 0X47, 0X25, 0X83, 0XE1,
+    0XD1, 0XB3, 0X15, 0X77, 0X5E, 0X3C, 0X9A, 0XF8,
+    0XFA, 0X98, 0X3E, 0X5C, 0X75, 0X17, 0XB1, 0XD3,
+    0XE3, 0X81, 0X27, 0X45, 0X6C, 0X0E, 0XA8, 0XCA,
+    0XAC, 0XCE, 0X68, 0X0A, 0X23, 0X41, 0XE7, 0X85,
+    0XB5, 0XD7, 0X71, 0X13, 0X3A, 0X58, 0XFE, 0X9C,
+    0X9E, 0XFC, 0X5A, 0X38, 0X11, 0X73, 0XD5, 0XB7,
+    0X87, 0XE5, 0X43, 0X21, 0X08, 0X6A, 0XCC, 0XAE,
+    0X97, 0XF5, 0X53, 0X31, 0X18, 0X7A, 0XDC, 0XBE,
+    0X8E, 0XEC, 0X4A, 0X28, 0X01, 0X63, 0XC5, 0XA7,
+    0XA5, 0XC7, 0X61, 0X03, 0X2A, 0X48, 0XEE, 0X8C,
+    0XBC, 0XDE, 0X78, 0X1A, 0X33, 0X51, 0XF7, 0X95,
+    0XF3, 0X91, 0X37, 0X55, 0X7C, 0X1E, 0XB8, 0XDA,
+    0XEA, 0X88, 0X2E, 0X4C, 0X65, 0X07, 0XA1, 0XC3,
+    0XC1, 0XA3, 0X05, 0X67, 0X4E, 0X2C, 0X8A, 0XE8,
+    0XD8, 0XBA, 0X1C, 0X7E, 0X57, 0X35, 0X93, 0XF1,
+    0X5F, 0X3D, 0X9B, 0XF9, 0XD0, 0XB2, 0X14, 0X76,
+    0X46, 0X24, 0X82, 0XE0, 0XC9, 0XAB, 0X0D, 0X6F,
+    0X6D, 0X0F, 0XA9, 0XCB, 0XE2, 0X80, 0X26, 0X44,
+    0X74, 0X16, 0XB0, 0XD2, 0XFB, 0X99, 0X3F, 0X5D,
+    0X3B, 0X59, 0XFF, 0X9D, 0XB4, 0XD6, 0X70, 0X12,
+    0X22, 0X40, 0XE6, 0X84, 0XAD, 0XCF, 0X69, 0X0B,
+    0X09, 0X6B, 0XCD, 0XAF, 0X86, 0XE4, 0X42, 0X20,
+    0X10, 0X72, 0XD4, 0XB6, 0X9F, 0XFD, 0X5B, 0X39
+  },
+  { // 5 trailing zero bytes
+    0000, 0X29, 0X52, 0X7B, 0XA4, 0X8D, 0XF6, 0XDF,
+    0X4F, 0X66, 0X1D, 0X34, 0XEB, 0XC2, 0XB9, 0X90,
+    0X9E, 0XB7, 0XCC, 0XE5, 0X3A, 0X13, 0X68, 0X41,
+    0XD1, 0XF8, 0X83, 0XAA, 0X75, 0X5C, 0X27, 0X0E,
+    0X3B, 0X12, 0X69, 0X40, 0X9F, 0XB6, 0XCD, 0XE4,
+    0X74, 0X5D, 0X26, 0X0F, 0XD0, 0XF9, 0X82, 0XAB,
+    0XA5, 0X8C, 0XF7, 0XDE, 0X01, 0X28, 0X53, 0X7A,
+    0XEA, 0XC3, 0XB8, 0X91, 0X4E, 0X67, 0X1C, 0X35,
+    0X76, 0X5F, 0X24, 0X0D, 0XD2, 0XFB, 0X80, 0XA9,
+    0X39, 0X10, 0X6B, 0X42, 0X9D, 0XB4, 0XCF, 0XE6,
+    0XE8, 0XC1, 0XBA, 0X93, 0X4C, 0X65, 0X1E, 0X37,
+    0XA7, 0X8E, 0XF5, 0XDC, 0X03, 0X2A, 0X51, 0X78,
+    0X4D, 0X64, 0X1F, 0X36, 0XE9, 0XC0, 0XBB, 0X92,
+    0X02, 0X2B, 0X50, 0X79, 0XA6, 0X8F, 0XF4, 0XDD,
+    0XD3, 0XFA, 0X81, 0XA8, 0X77, 0X5E, 0X25, 0X0C,
+    0X9C, 0XB5, 0XCE, 0XE7, 0X38, 0X11, 0X6A, 0X43,
+    0XEC, 0XC5, 0XBE, 0X97, 0X48, 0X61, 0X1A, 0X33,
+    0XA3, 0X8A, 0XF1, 0XD8, 0X07, 0X2E, 0X55, 0X7C,
+    0X72, 0X5B, 0X20, 0X09, 0XD6, 0XFF, 0X84, 0XAD,
+    0X3D, 0X14, 0X6F, 0X46, 0X99, 0XB0, 0XCB, 0XE2,
+    0XD7, 0XFE, 0X85, 0XAC, 0X73, 0X5A, 0X21, 0X08,
+    0X98, 0XB1, 0XCA, 0XE3, 0X3C, 0X15, 0X6E, 0X47,
+    0X49, 0X60, 0X1B, 0X32, 0XED, 0XC4, 0XBF, 0X96,
+    0X06, 0X2F, 0X54, 0X7D, 0XA2, 0X8B, 0XF0, 0XD9,
+    0X9A, 0XB3, 0XC8, 0XE1, 0X3E, 0X17, 0X6C, 0X45,
+    0XD5, 0XFC, 0X87, 0XAE, 0X71, 0X58, 0X23, 0X0A,
+    0X04, 0X2D, 0X56, 0X7F, 0XA0, 0X89, 0XF2, 0XDB,
+    0X4B, 0X62, 0X19, 0X30, 0XEF, 0XC6, 0XBD, 0X94,
+    0XA1, 0X88, 0XF3, 0XDA, 0X05, 0X2C, 0X57, 0X7E,
+    0XEE, 0XC7, 0XBC, 0X95, 0X4A, 0X63, 0X18, 0X31,
+    0X3F, 0X16, 0X6D, 0X44, 0X9B, 0XB2, 0XC9, 0XE0,
+    0X70, 0X59, 0X22, 0X0B, 0XD4, 0XFD, 0X86, 0XAF
+  },
+  { // 6 trailing zero bytes
+    0000, 0XDF, 0XB9, 0X66, 0X75, 0XAA, 0XCC, 0X13,
+    0XEA, 0X35, 0X53, 0X8C, 0X9F, 0X40, 0X26, 0XF9,
+    0XD3, 0X0C, 0X6A, 0XB5, 0XA6, 0X79, 0X1F, 0XC0,
+    0X39, 0XE6, 0X80, 0X5F, 0X4C, 0X93, 0XF5, 0X2A,
+    0XA1, 0X7E, 0X18, 0XC7, 0XD4, 0X0B, 0X6D, 0XB2,
+    0X4B, 0X94, 0XF2, 0X2D, 0X3E, 0XE1, 0X87, 0X58,
+    0X72, 0XAD, 0XCB, 0X14, 0X07, 0XD8, 0XBE, 0X61,
+    0X98, 0X47, 0X21, 0XFE, 0XED, 0X32, 0X54, 0X8B,
+    0X45, 0X9A, 0XFC, 0X23, 0X30, 0XEF, 0X89, 0X56,
+    0XAF, 0X70, 0X16, 0XC9, 0XDA, 0X05, 0X63, 0XBC,
+    0X96, 0X49, 0X2F, 0XF0, 0XE3, 0X3C, 0X5A, 0X85,
+    0X7C, 0XA3, 0XC5, 0X1A, 0X09, 0XD6, 0XB0, 0X6F,
+    0XE4, 0X3B, 0X5D, 0X82, 0X91, 0X4E, 0X28, 0XF7,
+    0X0E, 0XD1, 0XB7, 0X68, 0X7B, 0XA4, 0XC2, 0X1D,
+    0X37, 0XE8, 0X8E, 0X51, 0X42, 0X9D, 0XFB, 0X24,
+    0XDD, 0X02, 0X64, 0XBB, 0XA8, 0X77, 0X11, 0XCE,
+    0X8A, 0X55, 0X33, 0XEC, 0XFF, 0X20, 0X46, 0X99,
+    0X60, 0XBF, 0XD9, 0X06, 0X15, 0XCA, 0XAC, 0X73,
+    0X59, 0X86, 0XE0, 0X3F, 0X2C, 0XF3, 0X95, 0X4A,
+    0XB3, 0X6C, 0X0A, 0XD5, 0XC6, 0X19, 0X7F, 0XA0,
+    0X2B, 0XF4, 0X92, 0X4D, 0X5E, 0X81, 0XE7, 0X38,
+    0XC1, 0X1E, 0X78, 0XA7, 0XB4, 0X6B, 0X0D, 0XD2,
+    0XF8, 0X27, 0X41, 0X9E, 0X8D, 0X52, 0X34, 0XEB,
+    0X12, 0XCD, 0XAB, 0X74, 0X67, 0XB8, 0XDE, 0X01,
+    0XCF, 0X10, 0X76, 0XA9, 0XBA, 0X65, 0X03, 0XDC,
+    0X25, 0XFA, 0X9C, 0X43, 0X50, 0X8F, 0XE9, 0X36,
+    0X1C, 0XC3, 0XA5, 0X7A, 0X69, 0XB6, 0XD0, 0X0F,
+    0XF6, 0X29, 0X4F, 0X90, 0X83, 0X5C, 0X3A, 0XE5,
+    0X6E, 0XB1, 0XD7, 0X08, 0X1B, 0XC4, 0XA2, 0X7D,
+    0X84, 0X5B, 0X3D, 0XE2, 0XF1, 0X2E, 0X48, 0X97,
+    0XBD, 0X62, 0X04, 0XDB, 0XC8, 0X17, 0X71, 0XAE,
+    0X57, 0X88, 0XEE, 0X31, 0X22, 0XFD, 0X9B, 0X44
+  },
+  { // 7 trailing zero bytes
+    0000, 0X13, 0X26, 0X35, 0X4C, 0X5F, 0X6A, 0X79,
+    0X98, 0X8B, 0XBE, 0XAD, 0XD4, 0XC7, 0XF2, 0XE1,
+    0X37, 0X24, 0X11, 0X02, 0X7B, 0X68, 0X5D, 0X4E,
+    0XAF, 0XBC, 0X89, 0X9A, 0XE3, 0XF0, 0XC5, 0XD6,
+    0X6E, 0X7D, 0X48, 0X5B, 0X22, 0X31, 0X04, 0X17,
+    0XF6, 0XE5, 0XD0, 0XC3, 0XBA, 0XA9, 0X9C, 0X8F,
+    0X59, 0X4A, 0X7F, 0X6C, 0X15, 0X06, 0X33, 0X20,
+    0XC1, 0XD2, 0XE7, 0XF4, 0X8D, 0X9E, 0XAB, 0XB8,
+    0XDC, 0XCF, 0XFA, 0XE9, 0X90, 0X83, 0XB6, 0XA5,
+    0X44, 0X57, 0X62, 0X71, 0X08, 0X1B, 0X2E, 0X3D,
+    0XEB, 0XF8, 0XCD, 0XDE, 0XA7, 0XB4, 0X81, 0X92,
+    0X73, 0X60, 0X55, 0X46, 0X3F, 0X2C, 0X19, 0X0A,
+    0XB2, 0XA1, 0X94, 0X87, 0XFE, 0XED, 0XD8, 0XCB,
+    0X2A, 0X39, 0X0C, 0X1F, 0X66, 0X75, 0X40, 0X53,
+    0X85, 0X96, 0XA3, 0XB0, 0XC9, 0XDA, 0XEF, 0XFC,
+    0X1D, 0X0E, 0X3B, 0X28, 0X51, 0X42, 0X77, 0X64,
+    0XBF, 0XAC, 0X99, 0X8A, 0XF3, 0XE0, 0XD5, 0XC6,
+    0X27, 0X34, 0X01, 0X12, 0X6B, 0X78, 0X4D, 0X5E,
+    0X88, 0X9B, 0XAE, 0XBD, 0XC4, 0XD7, 0XE2, 0XF1,
+    0X10, 0X03, 0X36, 0X25, 0X5C, 0X4F, 0X7A, 0X69,
+    0XD1, 0XC2, 0XF7, 0XE4, 0X9D, 0X8E, 0XBB, 0XA8,
+    0X49, 0X5A, 0X6F, 0X7C, 0X05, 0X16, 0X23, 0X30,
+    0XE6, 0XF5, 0XC0, 0XD3, 0XAA, 0XB9, 0X8C, 0X9F,
+    0X7E, 0X6D, 0X58, 0X4B, 0X32, 0X21, 0X14, 0X07,
+    0X63, 0X70, 0X45, 0X56, 0X2F, 0X3C, 0X09, 0X1A,
+    0XFB, 0XE8, 0XDD, 0XCE, 0XB7, 0XA4, 0X91, 0X82,
+    0X54, 0X47, 0X72, 0X61, 0X18, 0X0B, 0X3E, 0X2D,
+    0XCC, 0XDF, 0XEA, 0XF9, 0X80, 0X93, 0XA6, 0XB5,
+    0X0D, 0X1E, 0X2B, 0X38, 0X41, 0X52, 0X67, 0X74,
+    0X95, 0X86, 0XB3, 0XA0, 0XD9, 0XCA, 0XFF, 0XEC,
+    0X3A, 0X29, 0X1C, 0X0F, 0X76, 0X65, 0X50, 0X43,
+    0XA2, 0XB1, 0X84, 0X97, 0XEE, 0XFD, 0XC8, 0XDB
+  },
+#endif
+};
+
+#define crc8_table crc8_slice[0]
+
+#else
+
 static const uint8_t crc8_table[256] =
 {
   0000, 0X07, 0X0E, 0X09, 0X1C, 0X1B, 0X12, 0X15,
@@ -129,13 +418,14 @@ static const uint8_t crc8_table[256] =
   0XE6, 0XE1, 0XE8, 0XEF, 0XFA, 0XFD, 0XF4, 0XF3
 };
 
-#define crc8(data,crc) (crc8_table[(data) ^ (crc)])
-/*
+#endif //LTC4162_CRC_SLICE
+
 uint8_t crc8(uint8_t data, uint8_t crc)
 {
   return crc8_table[data ^ crc];
 }
-*/
+
+#define crc8(data,crc) (crc8_table[(data) ^ (crc)]) // Inline lookup for the PEC functions below, crc8() above serves external callers.
 
 #endif //LTC4162_CRC_TABLE
 
@@ -154,7 +444,7 @@ uint8_t pec_read_word(uint8_t address, uint8_t command_code, uint16_t data)
   uint8_t remainder;
   remainder = crc8(address << 1, 0);
   remainder = crc8(command_code, remainder);
-  remainder = crc8((address << 1) | 1, 0);
+  remainder = crc8((address << 1) | 1, remainder);
   remainder = crc8(data & 0xFF, remainder);
   remainder = crc8((data >> 8) & 0xFF, remainder);
   return remainder; //Returns expected PEC byte to be received from slave device before Stop condition.
@@ -183,7 +473,7 @@ uint8_t pec_read_byte(uint8_t address, uint8_t command_code, uint8_t data)
   uint8_t remainder;
   remainder = crc8(address << 1, 0);
   remainder = crc8(command_code, remainder);
-  remainder = crc8((address << 1) | 1, 0);
+  remainder = crc8((address << 1) | 1, remainder);
   remainder = crc8(data, remainder);
   return remainder; //Returns expected PEC byte to be received from slave device before Stop condition.
 }
@@ -196,3 +486,106 @@ uint8_t pec_read_byte_test(uint8_t address, uint8_t command_code, uint8_t data,
   remainder = crc8(pec, remainder);
   return remainder; //Returns 0 for no errors.
 }
+
+uint8_t pec_block(const uint8_t *data, size_t length, uint8_t crc)
+{
+#ifdef LTC4162_CRC_SLICE
+  while (length >= LTC4162_CRC_SLICE)
+  {
+#if LTC4162_CRC_SLICE == 8
+    crc = crc8_slice[7][data[0] ^ crc] ^ crc8_slice[6][data[1]] ^ crc8_slice[5][data[2]] ^ crc8_slice[4][data[3]] ^
+          crc8_slice[3][data[4]] ^ crc8_slice[2][data[5]] ^ crc8_slice[1][data[6]] ^ crc8_slice[0][data[7]];
+#else
+    crc = crc8_slice[3][data[0] ^ crc] ^ crc8_slice[2][data[1]] ^ crc8_slice[1][data[2]] ^ crc8_slice[0][data[3]];
+#endif
+    data += LTC4162_CRC_SLICE;
+    length -= LTC4162_CRC_SLICE;
+  }
+#endif
+  while (length--) crc = crc8(*data++, crc);
+  return crc;
+}
+
+void pec_read_prefix_init(uint8_t prefix[256], uint8_t address)
+{
+  uint8_t remainder = crc8(address << 1, 0);
+  int command_code;
+  for (command_code = 0; command_code < 256; command_code++)
+  {
+    prefix[command_code] = crc8((address << 1) | 1, crc8(command_code, remainder));
+  }
+}
+
+uint8_t pec_read_word_prefixed(const uint8_t prefix[256], uint8_t command_code, uint16_t data)
+{
+  return crc8((data >> 8) & 0xFF, crc8(data & 0xFF, prefix[command_code]));
+}
+
+/* Known good PECs, computed independently of this file. */
+static const struct
+{
+  uint8_t address;
+  uint8_t command_code;
+  uint16_t data;
+  uint8_t write_pec;
+  uint8_t read_pec;
+} word_vectors[] =
+{
+  {0x68, 0x3A, 0x1234, 0x78, 0xCF},
+  {0x68, 0x14, 0x0000, 0xC4, 0x16},
+  {0x68, 0x19, 0x534D, 0x59, 0xE4},
+  {0x68, 0x4B, 0xFFFF, 0x83, 0x1C},
+  {0x09, 0x00, 0x8000, 0xC2, 0x60},
+  {0x7F, 0xFF, 0x00FF, 0x3B, 0x76},
+};
+static const struct
+{
+  uint8_t address;
+  uint8_t command_code;
+  uint8_t data;
+  uint8_t write_pec;
+  uint8_t read_pec;
+} byte_vectors[] =
+{
+  {0x68, 0x39, 0x5A, 0xEA, 0x38},
+  {0x0C, 0x00, 0xD0, 0xCD, 0x03},
+  {0x7F, 0xFF, 0xFF, 0x64, 0xC8},
+};
+
+uint8_t pec_self_test(void)
+{
+  static const char check[] = "123456789";
+  uint8_t prefix[256];
+  uint8_t frame[5];
+  uint8_t failures = 0;
+  uint8_t remainder = 0;
+  uint8_t i;
+  for (i = 0; i < sizeof(check) - 1; i++) remainder = crc8(check[i], remainder);
+  if (remainder != 0xF4) failures++; // CRC-8/SMBUS check value
+  if (pec_block((const uint8_t *)check, sizeof(check) - 1, 0) != 0xF4) failures++;
+  for (i = 0; i < sizeof(check) - 1; i++) // Every split point, so each slicing tail length is exercised
+  {
+    if (pec_block((const uint8_t *)check + i, sizeof(check) - 1 - i, pec_block((const uint8_t *)check, i, 0)) != 0xF4) failures++;
+  }
+  for (i = 0; i < sizeof(word_vectors) / sizeof(word_vectors[0]); i++)
+  {
+    if (pec_write_word(word_vectors[i].address, word_vectors[i].command_code, word_vectors[i].data) != word_vectors[i].write_pec) failures++;
+    if (pec_read_word(word_vectors[i].address, word_vectors[i].command_code, word_vectors[i].data) != word_vectors[i].read_pec) failures++;
+    if (pec_read_word_test(word_vectors[i].address, word_vectors[i].command_code, word_vectors[i].data, word_vectors[i].read_pec) != 0) failures++;
+    frame[0] = word_vectors[i].address << 1;
+    frame[1] = word_vectors[i].command_code;
+    frame[2] = word_vectors[i].data & 0xFF;
+    frame[3] = word_vectors[i].data >> 8;
+    frame[4] = word_vectors[i].write_pec;
+    if (pec_block(frame, 5, 0) != 0) failures++; // A frame followed by its own PEC leaves no remainder
+    pec_read_prefix_init(prefix, word_vectors[i].address);
+    if (pec_read_word_prefixed(prefix, word_vectors[i].command_code, word_vectors[i].data) != word_vectors[i].read_pec) failures++;
+  }
+  for (i = 0; i < sizeof(byte_vectors) / sizeof(byte_vectors[0]); i++)
+  {
+    if (pec_write_byte(byte_vectors[i].address, byte_vectors[i].command_code, byte_vectors[i].data) != byte_vectors[i].write_pec) failures++;
+    if (pec_read_byte(byte_vectors[i].address, byte_vectors[i].command_code, byte_vectors[i].data) != byte_vectors[i].read_pec) failures++;
+    if (pec_read_byte_test(byte_vectors[i].address, byte_vectors[i].command_code, byte_vectors[i].data, byte_vectors[i].read_pec) != 0) failures++;
+  }
+  return failures;
+}
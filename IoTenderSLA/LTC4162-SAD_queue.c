@@ -0,0 +1,145 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-S is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters as well as numerous system status
+alerts. The LTC4162-S can charge from one to four 6V Lead-Acid batteries or one
+to two 12V Lead-Acid batteries with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-S is
+available in an I²C adjustable version as well a fixed voltage version both with
+and without MPPT enabled by default. The LTC4162-S is available in the 28-pin
+4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date$
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-SAD
+ *  @brief LTC4162-SAD non-blocking SMBus transaction queue.
+ */
+
+#include "LTC4162-SAD_queue.h"
+
+static int submit(LTC4162_queue_t *queue, uint16_t registerinfo, uint16_t data, uint8_t write, LTC4162_write_policy_t policy, LTC4162_queue_callback callback, void *context)
+{
+  LTC4162_transaction_t *transaction;
+  if (queue->count == queue->size)
+  {
+    queue->rejected++;
+    return 1;
+  }
+  transaction = &queue->slots[(queue->head + queue->count) % queue->size];
+  transaction->registerinfo = registerinfo;
+  transaction->data = data;
+  transaction->write = write;
+  transaction->policy = policy;
+  transaction->callback = callback;
+  transaction->context = context;
+  queue->count++;
+  return 0;
+}
+
+void LTC4162_queue_init(LTC4162_queue_t *queue, LTC4162_chip_cfg_t *chip, LTC4162_transaction_t *slots, uint8_t size)
+{
+  queue->chip = chip;
+  queue->slots = slots;
+  queue->size = size;
+  queue->head = 0;
+  queue->count = 0;
+  queue->rejected = 0;
+}
+
+int LTC4162_queue_read(LTC4162_queue_t *queue, uint16_t registerinfo, LTC4162_queue_callback callback, void *context)
+{
+  return submit(queue, registerinfo, 0, 0, LTC4162_WRITE_TRUST_PEC, callback, context);
+}
+
+int LTC4162_queue_write(LTC4162_queue_t *queue, uint16_t registerinfo, uint16_t data, LTC4162_queue_callback callback, void *context)
+{
+  return submit(queue, registerinfo, data, 1, LTC4162_WRITE_TRUST_PEC, callback, context);
+}
+
+int LTC4162_queue_write_policy(LTC4162_queue_t *queue, uint16_t registerinfo, uint16_t data, LTC4162_write_policy_t policy, LTC4162_queue_callback callback, void *context)
+{
+  return submit(queue, registerinfo, data, 1, policy, callback, context);
+}
+
+uint8_t LTC4162_queue_service(LTC4162_queue_t *queue, uint8_t max_transactions)
+{
+  uint8_t done = 0;
+  LTC4162_transaction_t transaction;
+  int failure;
+  while (queue->count && done < max_transactions)
+  {
+    /* Copy out and retire the slot first so the callback may submit follow-up transactions. */
+    transaction = queue->slots[queue->head];
+    queue->head = (queue->head + 1) % queue->size;
+    queue->count--;
+    if (transaction.write)
+    {
+      failure = LTC4162_write_register_policy(queue->chip, transaction.registerinfo, transaction.data, (LTC4162_write_policy_t)transaction.policy);
+    }
+    else
+    {
+      failure = LTC4162_read_register(queue->chip, transaction.registerinfo, &transaction.data);
+    }
+    if (transaction.callback != NULL) transaction.callback(failure, transaction.data, transaction.context);
+    done++;
+  }
+  return done;
+}
+
+uint8_t LTC4162_queue_pending(const LTC4162_queue_t *queue)
+{
+  return queue->count;
+}
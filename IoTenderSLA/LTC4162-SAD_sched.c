@@ -0,0 +1,163 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-S is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters as well as numerous system status
+alerts. The LTC4162-S can charge from one to four 6V Lead-Acid batteries or one
+to two 12V Lead-Acid batteries with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-S is
+available in an I²C adjustable version as well a fixed voltage version both with
+and without MPPT enabled by default. The LTC4162-S is available in the 28-pin
+4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date$
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-SAD
+ *  @brief LTC4162-SAD cooperative periodic task scheduler.
+ */
+
+#include "LTC4162-SAD_sched.h"
+
+void LTC4162_sched_init(LTC4162_sched_t *sched, LTC4162_task_t *tasks, uint8_t count, uint32_t (*clock_ms)(void), uint32_t (*clock_cycles)(void))
+{
+  uint32_t now = clock_ms();
+  uint8_t i;
+  sched->tasks = tasks;
+  sched->count = count;
+  sched->clock_ms = clock_ms;
+  sched->clock_cycles = clock_cycles;
+  for (i = 0; i < count; i++)
+  {
+    tasks[i].release_ms = now;
+    tasks[i].woken = 0;
+  }
+  LTC4162_sched_reset_stats(sched);
+}
+
+void LTC4162_sched_reset_stats(LTC4162_sched_t *sched)
+{
+  uint8_t i;
+  for (i = 0; i < sched->count; i++)
+  {
+    LTC4162_task_t *task = &sched->tasks[i];
+    task->runs = 0;
+    task->misses = 0;
+    task->overruns = 0;
+    task->max_cycles = 0;
+    task->max_lateness_ms = 0;
+  }
+}
+
+uint8_t LTC4162_sched_run(LTC4162_sched_t *sched)
+{
+  uint8_t i, ran = 0;
+  for (i = 0; i < sched->count; i++)
+  {
+    LTC4162_task_t *task = &sched->tasks[i];
+    uint32_t now = sched->clock_ms();
+    uint8_t released = task->period_ms != 0 && (int32_t)(now - task->release_ms) >= 0;
+    int32_t late;
+    uint32_t lateness, start, cycles;
+    if (!released && !task->woken) continue;
+    late = (int32_t)(now - (released ? task->release_ms : task->woken_ms));
+    lateness = late > 0 ? (uint32_t)late : 0;   // A wake from a timer callback may be stamped after now was read
+    task->woken = 0;
+    if (released)
+    {
+      uint32_t behind;
+      task->release_ms += task->period_ms;
+      behind = now - task->release_ms;
+      if ((int32_t)behind >= 0)                  // A whole period late: skip to the next release still ahead
+      {
+        uint32_t skipped = behind / task->period_ms + 1;
+        task->misses += skipped;
+        task->release_ms += skipped * task->period_ms;
+      }
+    }
+    start = sched->clock_cycles();
+    task->run(task->context);
+    cycles = sched->clock_cycles() - start;
+    task->runs++;
+    if (lateness > task->deadline_ms) task->misses++;
+    if (lateness > task->max_lateness_ms) task->max_lateness_ms = lateness;
+    if (cycles > task->budget_cycles) task->overruns++;
+    if (cycles > task->max_cycles) task->max_cycles = cycles;
+    ran++;
+  }
+  return ran;
+}
+
+void LTC4162_sched_wake(LTC4162_sched_t *sched, LTC4162_task_t *task)
+{
+  if (task->woken) return;
+  task->woken_ms = sched->clock_ms();
+  task->woken = 1;
+}
+
+uint32_t LTC4162_sched_idle_ms(const LTC4162_sched_t *sched)
+{
+  uint32_t now = sched->clock_ms(), idle = UINT32_MAX;
+  uint8_t i;
+  for (i = 0; i < sched->count; i++)
+  {
+    const LTC4162_task_t *task = &sched->tasks[i];
+    int32_t until = (int32_t)(task->release_ms - now);
+    if (task->woken) return 0;
+    if (task->period_ms == 0) continue;
+    if (until <= 0) return 0;
+    if ((uint32_t)until < idle) idle = (uint32_t)until;
+  }
+  return idle;
+}
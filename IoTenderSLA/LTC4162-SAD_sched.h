@@ -0,0 +1,146 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-S is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters as well as numerous system status
+alerts. The LTC4162-S can charge from one to four 6V Lead-Acid batteries or one
+to two 12V Lead-Acid batteries with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-S is
+available in an I²C adjustable version as well a fixed voltage version both with
+and without MPPT enabled by default. The LTC4162-S is available in the 28-pin
+4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date$
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-SAD
+ *  @brief LTC4162-SAD cooperative periodic task scheduler.
+ *
+ *  Runs a fixed table of tasks from the main loop, each at its own period or when woken, so that telemetry, LEDs,
+ *  bus housekeeping and the web server no longer share one uncontrolled rate. Releases are fixed rate: a task
+ *  released at t is next released at t + period however late it ran, and releases it falls a whole period behind on
+ *  are skipped and counted rather than run back to back. Tasks are never preempted, so each run is timed in processor
+ *  cycles against its budget, and each start is checked against its deadline.
+ *
+ *  The millisecond and cycle clocks are function pointers, millis() and ESP.getCycleCount() on the ESP8266, so that
+ *  a host build can drive the schedule from a virtual clock.
+ */
+
+#ifndef LTC4162_SCHED_H_
+#define LTC4162_SCHED_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+  /*! A task's work, run to completion. */
+  typedef void (*LTC4162_task_function)(void *context //!< Context pointer given in the task table
+                                       );
+
+  /*! One task: its timing requirements, set in the table, then its state and statistics, kept by the scheduler. */
+  typedef struct
+  {
+    const char *name;              //!< Shown with the statistics
+    LTC4162_task_function run;     //!< Work to do at each release
+    void *context;                 //!< Passed to run unchanged
+    uint32_t period_ms;            //!< Time between releases, 0 for a task that runs only when woken
+    uint32_t deadline_ms;          //!< Latest start after release or wake, later starts are counted as misses
+    uint32_t budget_cycles;        //!< Most cycles one run should take, longer runs are counted as overruns
+    uint32_t release_ms;           //!< Next periodic release
+    uint32_t woken_ms;             //!< Time of the pending wake
+    volatile uint8_t woken;        //!< Set by @ref LTC4162_sched_wake, cleared when the task runs
+    uint32_t runs;                 //!< Times run
+    uint32_t misses;               //!< Runs started past the deadline, plus releases skipped
+    uint32_t overruns;             //!< Runs that exceeded budget_cycles
+    uint32_t max_cycles;           //!< Longest run
+    uint32_t max_lateness_ms;      //!< Longest delay from release or wake to start, the task's jitter
+  } LTC4162_task_t;
+
+  /*! A task table and the clocks it runs on. */
+  typedef struct
+  {
+    LTC4162_task_t *tasks;             //!< Caller supplied tasks, in priority order
+    uint8_t count;                     //!< Number of tasks
+    uint32_t (*clock_ms)(void);        //!< Free running millisecond clock, e.g. millis()
+    uint32_t (*clock_cycles)(void);    //!< Free running processor cycle counter, e.g. ESP.getCycleCount()
+  } LTC4162_sched_t;
+
+  /*! Prepares a schedule over tasks[0..count-1], releasing every periodic task now and clearing the statistics. */
+  void LTC4162_sched_init(LTC4162_sched_t *sched,           //!< Schedule to initialize
+                          LTC4162_task_t *tasks,            //!< Task table with name, run, context, period_ms, deadline_ms and budget_cycles set
+                          uint8_t count,                    //!< Number of tasks
+                          uint32_t (*clock_ms)(void),       //!< Millisecond clock
+                          uint32_t (*clock_cycles)(void)    //!< Cycle counter
+                         );
+  /*! Runs each task that is released or woken, once, in table order. Returns the number run. */
+  uint8_t LTC4162_sched_run(LTC4162_sched_t *sched //!< Schedule to run
+                           );
+  /*! Asks for task to run at the next @ref LTC4162_sched_run, as well as at its period. Safe from timer callbacks. */
+  void LTC4162_sched_wake(LTC4162_sched_t *sched, //!< Schedule the task belongs to
+                          LTC4162_task_t *task    //!< Task to run
+                         );
+  /*! Returns the milliseconds until the next periodic release, 0 if a task is due or woken, so the caller may sleep. */
+  uint32_t LTC4162_sched_idle_ms(const LTC4162_sched_t *sched //!< Schedule to examine
+                                );
+  /*! Clears the run, miss and overrun counters and the maxima of every task. */
+  void LTC4162_sched_reset_stats(LTC4162_sched_t *sched //!< Schedule whose statistics to clear
+                                );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LTC4162_SCHED_H_ */
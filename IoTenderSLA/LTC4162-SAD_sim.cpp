@@ -0,0 +1,304 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-S is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters as well as numerous system status
+alerts. The LTC4162-S can charge from one to four 6V Lead-Acid batteries or one
+to two 12V Lead-Acid batteries with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-S is
+available in an I²C adjustable version as well a fixed voltage version both with
+and without MPPT enabled by default. The LTC4162-S is available in the 28-pin
+4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date$
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-SAD
+ *  @brief LTC4162-SAD register level simulator for host builds.
+ */
+
+#ifndef ARDUINO
+
+#include "LTC4162-SAD_sim.h"
+#include "LTC4162-SAD_pec.h"
+#include <chrono>
+
+/* Bits the LTC4162 clears by itself once the requested operation completes. */
+#define SELF_CLEARING_CONFIG_BITS (LTC4162_RUN_BSR_MASK | LTC4162_EQUALIZE_REQ_MASK)
+
+/* Implemented, writable and write-0-to-clear bits and power-on default of each register, from LTC4162-SAD_reg_defs.h. */
+struct register_description
+{
+  uint8_t command_code;
+  uint16_t readable;
+  uint16_t writable;
+  uint16_t clear_on_zero;
+  uint16_t power_on;
+};
+static const struct register_description register_map[] =
+{
+  //command_code readable writable clear_on_zero power_on
+  {LTC4162_VBAT_LO_ALERT_LIMIT_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x0000},
+  {LTC4162_VBAT_HI_ALERT_LIMIT_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x0000},
+  {LTC4162_VIN_LO_ALERT_LIMIT_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x0000},
+  {LTC4162_VIN_HI_ALERT_LIMIT_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x0000},
+  {LTC4162_VOUT_LO_ALERT_LIMIT_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x0000},
+  {LTC4162_VOUT_HI_ALERT_LIMIT_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x0000},
+  {LTC4162_IIN_HI_ALERT_LIMIT_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x0000},
+  {LTC4162_IBAT_LO_ALERT_LIMIT_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x0000},
+  {LTC4162_DIE_TEMP_HI_ALERT_LIMIT_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x0000},
+  {LTC4162_BSR_HI_ALERT_LIMIT_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x0000},
+  {LTC4162_THERMISTOR_VOLTAGE_HI_ALERT_LIMIT_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x0000},
+  {LTC4162_THERMISTOR_VOLTAGE_LO_ALERT_LIMIT_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x0000},
+  {LTC4162_EN_LIMIT_ALERTS_REG_SUBADDR, 0xCFFF, 0xCFFF, 0x0000, 0x0000},
+  {LTC4162_EN_CHARGER_STATE_ALERTS_REG_SUBADDR, 0x1F43, 0x1F43, 0x0000, 0x0000},
+  {LTC4162_EN_CHARGE_STATUS_ALERTS_REG_SUBADDR, 0x003F, 0x003F, 0x0000, 0x0000},
+  {LTC4162_THERMAL_REG_START_TEMP_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x45E9},
+  {LTC4162_THERMAL_REG_END_TEMP_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x46D2},
+  {LTC4162_CONFIG_BITS_REG_SUBADDR, 0x003F, 0x003F, 0x0000, 0x0000},
+  {LTC4162_IIN_LIMIT_TARGET_REG_SUBADDR, 0x003F, 0x003F, 0x0000, 0x003F},
+  {LTC4162_INPUT_UNDERVOLTAGE_SETTING_REG_SUBADDR, 0x00FF, 0x00FF, 0x0000, 0x001F},
+  {LTC4162_ARM_SHIP_MODE_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x0000},
+  {LTC4162_CHARGE_CURRENT_SETTING_REG_SUBADDR, 0x001F, 0x001F, 0x0000, 0x001F},
+  {LTC4162_VCHARGE_SETTING_REG_SUBADDR, 0x003F, 0x003F, 0x0000, 0x0015},
+  {LTC4162_C_OVER_X_THRESHOLD_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x0888},
+  {LTC4162_CHARGER_CONFIG_BITS_REG_SUBADDR, 0x0002, 0x0002, 0x0000, 0x0002},
+  {LTC4162_VABSORB_DELTA_REG_SUBADDR, 0x003F, 0x003F, 0x0000, 0x0015},
+  {LTC4162_MAX_ABSORB_TIME_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x1518},
+  {LTC4162_V_EQUALIZE_DELTA_REG_SUBADDR, 0x003F, 0x003F, 0x0000, 0x002A},
+  {LTC4162_EQUALIZE_TIME_REG_SUBADDR, 0xFFFF, 0xFFFF, 0x0000, 0x0E10},
+  {LTC4162_TABSORBTIMER_REG_SUBADDR, 0xFFFF, 0x0000, 0x0000, 0x0000},
+  {LTC4162_TEQUALIZETIMER_REG_SUBADDR, 0xFFFF, 0x0000, 0x0000, 0x0000},
+  {LTC4162_CHARGER_STATE_REG_SUBADDR, 0x1FFF, 0x0000, 0x0000, 0x0100},
+  {LTC4162_CHARGE_STATUS_REG_SUBADDR, 0x003F, 0x0000, 0x0000, 0x0000},
+  {LTC4162_LIMIT_ALERTS_REG_SUBADDR, 0xCFFF, 0x0000, 0xCFFF, 0x0000},
+  {LTC4162_CHARGER_STATE_ALERTS_REG_SUBADDR, 0x1F43, 0x0000, 0x1F43, 0x0000},
+  {LTC4162_CHARGE_STATUS_ALERTS_REG_SUBADDR, 0x003F, 0x0000, 0x003F, 0x0000},
+  {LTC4162_SYSTEM_STATUS_REG_SUBADDR, 0x01BF, 0x0000, 0x0000, 0x0000},
+  {LTC4162_VBAT_REG_SUBADDR, 0xFFFF, 0x0000, 0x0000, 0x0000},
+  {LTC4162_VIN_REG_SUBADDR, 0xFFFF, 0x0000, 0x0000, 0x0000},
+  {LTC4162_VOUT_REG_SUBADDR, 0xFFFF, 0x0000, 0x0000, 0x0000},
+  {LTC4162_IBAT_REG_SUBADDR, 0xFFFF, 0x0000, 0x0000, 0x0000},
+  {LTC4162_IIN_REG_SUBADDR, 0xFFFF, 0x0000, 0x0000, 0x0000},
+  {LTC4162_DIE_TEMP_REG_SUBADDR, 0xFFFF, 0x0000, 0x0000, 0x0000},
+  {LTC4162_THERMISTOR_VOLTAGE_REG_SUBADDR, 0xFFFF, 0x0000, 0x0000, 0x0000},
+  {LTC4162_BSR_REG_SUBADDR, 0xFFFF, 0x0000, 0x0000, 0x0000},
+  {LTC4162_CHEM_CELLS_REG_SUBADDR, 0x0F0F, 0x0000, 0x0000, 0x0000},
+  {LTC4162_ICHARGE_DAC_REG_SUBADDR, 0x001F, 0x0000, 0x0000, 0x0000},
+  {LTC4162_VCHARGE_DAC_REG_SUBADDR, 0x003F, 0x0000, 0x0000, 0x0000},
+  {LTC4162_IIN_LIMIT_DAC_REG_SUBADDR, 0x003F, 0x0000, 0x0000, 0x0000},
+  {LTC4162_VBAT_FILT_REG_SUBADDR, 0xFFFF, 0x0000, 0x0000, 0x0000},
+  {LTC4162_BSR_CHARGE_CURRENT_REG_SUBADDR, 0xFFFF, 0x0000, 0x0000, 0x0000},
+  {LTC4162_TELEMETRY_STATUS_REG_SUBADDR, 0x0003, 0x0000, 0x0000, 0x0000},
+  {LTC4162_INPUT_UNDERVOLTAGE_DAC_REG_SUBADDR, 0x00FF, 0x0000, 0x0000, 0x0000},
+};
+#define REGISTER_COUNT (sizeof(register_map) / sizeof(register_map[0]))
+
+static LTC4162_sim *sim(struct port_configuration *pc)
+{
+  return reinterpret_cast<LTC4162_sim *>(pc);
+}
+
+LTC4162_sim::LTC4162_sim(uint8_t address)
+  : reads(0), writes(0), nacks(0), pec_errors(0), address(address),
+    read_latency_us(0), write_latency_us(0), spin(false), pec_corruptions(0), elapsed_us(0)
+{
+  static_assert(sizeof(registers) / sizeof(registers[0]) == REGISTER_COUNT, "Register storage does not match register_map");
+  for (unsigned i = 0; i < REGISTER_COUNT; i++) registers[i].description = &register_map[i];
+  power_on_reset();
+}
+
+void LTC4162_sim::power_on_reset()
+{
+  for (unsigned i = 0; i < REGISTER_COUNT; i++) registers[i].value = register_map[i].power_on;
+}
+
+void LTC4162_sim::attach(LTC4162_chip_cfg_t *chip)
+{
+  chip->address = address;
+  chip->read_register = smbus_read_register;
+  chip->write_register = smbus_write_register;
+  chip->read_register_list = smbus_read_register_list;
+  chip->port_configuration = reinterpret_cast<struct port_configuration *>(this);
+}
+
+struct LTC4162_sim::reg *LTC4162_sim::find(uint8_t command_code)
+{
+  for (unsigned i = 0; i < REGISTER_COUNT; i++)
+  {
+    if (registers[i].description->command_code == command_code) return &registers[i];
+  }
+  return NULL;
+}
+
+const struct LTC4162_sim::reg *LTC4162_sim::find(uint8_t command_code) const
+{
+  return const_cast<LTC4162_sim *>(this)->find(command_code);
+}
+
+void LTC4162_sim::advance(uint32_t us)
+{
+  elapsed_us += us;
+  if (spin && us)
+  {
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now() + std::chrono::microseconds(us);
+    while (std::chrono::steady_clock::now() < end);
+  }
+}
+
+int LTC4162_sim::read_word(uint8_t address, uint8_t command_code, uint16_t *data, uint8_t *pec)
+{
+  struct reg *r = find(command_code);
+  reads++;
+  advance(read_latency_us);
+  if (address != this->address || r == NULL)
+  {
+    nacks++;
+    return NACK;
+  }
+  *data = r->value;
+  *pec = pec_read_word(address, command_code, *data);
+  if (pec_corruptions)
+  {
+    pec_corruptions--;
+    *pec ^= 0x01;
+  }
+  return 0;
+}
+
+int LTC4162_sim::write_word(uint8_t address, uint8_t command_code, uint16_t data, uint8_t pec)
+{
+  struct reg *r = find(command_code);
+  writes++;
+  advance(write_latency_us);
+  if (address != this->address || r == NULL)
+  {
+    nacks++;
+    return NACK;
+  }
+  if (pec != pec_write_word(address, command_code, data))
+  {
+    pec_errors++;
+    return PEC_ERROR;
+  }
+  r->value = (r->value & ~r->description->writable) | (data & r->description->writable);
+  r->value &= data | ~r->description->clear_on_zero;
+  return 0;
+}
+
+void LTC4162_sim::set(uint8_t command_code, uint16_t data)
+{
+  struct reg *r = find(command_code);
+  if (r != NULL) r->value = data & r->description->readable;
+}
+
+uint16_t LTC4162_sim::get(uint8_t command_code) const
+{
+  const struct reg *r = find(command_code);
+  return r == NULL ? 0 : r->value;
+}
+
+void LTC4162_sim::complete_commands()
+{
+  find(LTC4162_CONFIG_BITS_REG_SUBADDR)->value &= ~SELF_CLEARING_CONFIG_BITS;
+}
+
+bool LTC4162_sim::ship_mode_armed() const
+{
+  return get(LTC4162_ARM_SHIP_MODE_REG_SUBADDR) == LTC4162_ARM_SHIP_MODE_ENUM_ARM;
+}
+
+void LTC4162_sim::set_latency_us(uint32_t read_us, uint32_t write_us, bool spin)
+{
+  read_latency_us = read_us;
+  write_latency_us = write_us;
+  this->spin = spin;
+}
+
+void LTC4162_sim::corrupt_pec(uint32_t count)
+{
+  pec_corruptions = count;
+}
+
+uint32_t LTC4162_sim::now_us() const
+{
+  return elapsed_us;
+}
+
+int LTC4162_sim::smbus_read_register(uint8_t address, uint8_t command_code, uint16_t *data, struct port_configuration *pc)
+{
+  uint8_t pec;
+  int failure = sim(pc)->read_word(address, command_code, data, &pec);
+  if (failure) return failure;
+  if (pec != pec_read_word(address, command_code, *data)) return PEC_ERROR;
+  return 0;
+}
+
+int LTC4162_sim::smbus_write_register(uint8_t address, uint8_t command_code, uint16_t data, struct port_configuration *pc)
+{
+  return sim(pc)->write_word(address, command_code, data, pec_write_word(address, command_code, data));
+}
+
+int LTC4162_sim::smbus_read_register_list(uint8_t address, const uint8_t *command_codes, uint16_t *data, uint8_t count, struct port_configuration *pc)
+{
+  int failure;
+  for (uint8_t i = 0; i < count; i++)
+  {
+    failure = smbus_read_register(address, command_codes[i], &data[i], pc);
+    if (failure) return failure;
+  }
+  return 0;
+}
+
+#endif /* ARDUINO */
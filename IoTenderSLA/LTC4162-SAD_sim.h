@@ -0,0 +1,172 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-S is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters as well as numerous system status
+alerts. The LTC4162-S can charge from one to four 6V Lead-Acid batteries or one
+to two 12V Lead-Acid batteries with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-S is
+available in an I²C adjustable version as well a fixed voltage version both with
+and without MPPT enabled by default. The LTC4162-S is available in the 28-pin
+4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date$
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-SAD
+ *  @brief LTC4162-SAD register level simulator for host builds.
+ *
+ *  Models the LTC4162-S register map behind the same smbus_read_register, smbus_write_register
+ *  and smbus_read_register_list interface that real hardware ports supply, so the driver can be
+ *  exercised and benchmarked on a workstation without a board:
+ *    - unimplemented bits read back as 0 and ignore writes,
+ *    - read only registers ignore writes,
+ *    - alert bits are cleared by writing them back to 0 and are left alone by writing 1,
+ *    - ARM_SHIP_MODE only arms on the LTC4162_ARM_SHIP_MODE_ENUM_ARM key value,
+ *    - every word read carries a PEC byte and every word written is PEC checked,
+ *    - each transaction advances a simulated microsecond clock by a configurable latency,
+ *      optionally also spinning for that long in real time.
+ *
+ *  Measurements, state and alerts are set by the test bench with @ref LTC4162_sim::set.
+ *  Command codes outside the register map, or a different address, are not acknowledged.
+ *
+ *  LTC4162-SAD_sim.cpp is only compiled outside the Arduino environment.
+ */
+
+#ifndef LTC4162_SIM_H_
+#define LTC4162_SIM_H_
+
+#include "LTC4162-SAD.h"
+
+class LTC4162_sim
+{
+  public:
+    /*! Non-zero return codes of the bus functions. */
+    enum
+    {
+      NACK = 1,      //!< Address or command code not acknowledged
+      PEC_ERROR = 2  //!< Packet Error Check mismatch on a read or write
+    };
+
+    LTC4162_sim(uint8_t address = LTC4162_ADDR_68 //!< 7-bit SMBus address the simulated chip responds to
+               );
+
+    /*! Returns every register to its power-on default and disarms ship mode. Statistics and settings are kept. */
+    void power_on_reset();
+
+    /*! Fills in the address and bus functions of chip so that the driver talks to this simulator. */
+    void attach(LTC4162_chip_cfg_t *chip //!< Pointer to chip configuration struct
+               );
+
+    /*! SMBus read_word as seen on the wire. Returns 0 and the word with its PEC byte, or NACK. */
+    int read_word(uint8_t address,      //!< 7-bit SMBus address
+                  uint8_t command_code, //!< Register to read
+                  uint16_t *data,       //!< Pointer to data destination
+                  uint8_t *pec          //!< Pointer to PEC byte destination
+                 );
+    /*! SMBus write_word with PEC as seen on the wire. Returns 0, NACK or PEC_ERROR. A rejected write changes nothing. */
+    int write_word(uint8_t address,      //!< 7-bit SMBus address
+                   uint8_t command_code, //!< Register to write
+                   uint16_t data,        //!< Data to write
+                   uint8_t pec           //!< PEC byte sent by the host
+                  );
+
+    /*! Test bench access to a register, bypassing the access rules. Unimplemented bits are dropped. */
+    void set(uint8_t command_code, uint16_t data);
+    /*! Test bench view of a register without a bus transaction. */
+    uint16_t get(uint8_t command_code) const;
+    /*! Clears the self-clearing command bits, as the LTC4162 does once the requested operation finishes. */
+    void complete_commands();
+    /*! True once ARM_SHIP_MODE holds the arming key. */
+    bool ship_mode_armed() const;
+
+    /*! Sets how far each transaction advances the simulated clock. With spin set, each transaction also busy-waits that long. */
+    void set_latency_us(uint32_t read_us, uint32_t write_us, bool spin);
+    /*! Corrupts the PEC byte of the next count words read. */
+    void corrupt_pec(uint32_t count);
+    /*! Simulated microseconds spent on the bus since construction. */
+    uint32_t now_us() const;
+
+    uint32_t reads;      //!< Words read, including those rejected
+    uint32_t writes;     //!< Words written, including those rejected
+    uint32_t nacks;      //!< Transactions not acknowledged
+    uint32_t pec_errors; //!< Writes rejected for a bad PEC byte
+
+    /*! smbus_read_register for @ref LTC4162_chip_cfg_t. Verifies the PEC byte like a hardware port would. */
+    static int smbus_read_register(uint8_t address, uint8_t command_code, uint16_t *data, struct port_configuration *pc);
+    /*! smbus_write_register for @ref LTC4162_chip_cfg_t. Sends the PEC byte like a hardware port would. */
+    static int smbus_write_register(uint8_t address, uint8_t command_code, uint16_t data, struct port_configuration *pc);
+    /*! smbus_read_register_list for @ref LTC4162_chip_cfg_t. */
+    static int smbus_read_register_list(uint8_t address, const uint8_t *command_codes, uint16_t *data, uint8_t count, struct port_configuration *pc);
+
+  private:
+    struct reg
+    {
+      uint16_t value;
+      const struct register_description *description;
+    };
+    void advance(uint32_t us);
+    struct reg *find(uint8_t command_code);
+    const struct reg *find(uint8_t command_code) const;
+
+    uint8_t address;
+    struct reg registers[53];
+    uint32_t read_latency_us;
+    uint32_t write_latency_us;
+    bool spin;
+    uint32_t pec_corruptions;
+    uint32_t elapsed_us;
+};
+
+#endif /* LTC4162_SIM_H_ */
@@ -0,0 +1,164 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-S is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters as well as numerous system status
+alerts. The LTC4162-S can charge from one to four 6V Lead-Acid batteries or one
+to two 12V Lead-Acid batteries with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-S is
+available in an I²C adjustable version as well a fixed voltage version both with
+and without MPPT enabled by default. The LTC4162-S is available in the 28-pin
+4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date$
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-SAD
+ *  @brief LTC4162-SAD non-blocking solar panel detection.
+ */
+
+#include "LTC4162-SAD_solar.h"
+
+static int measure_battery(LTC4162_solar_t *solar, LTC4162_chip_cfg_t *chip)
+{
+  uint16_t cell_count, data;
+  int failure = LTC4162_read_register(chip, LTC4162_CELL_COUNT, &cell_count);
+  if (!failure) failure = LTC4162_read_register(chip, LTC4162_VBAT, &data);
+  if (failure) return failure;
+  solar->vbat_mv = LTC4162_VBAT_SLA_FORMAT_I2FIX(data) * cell_count / 2;
+  solar->measured = 1;
+  return 0;
+}
+
+static int regulate_above_battery(LTC4162_solar_t *solar, LTC4162_chip_cfg_t *chip)
+{
+  return LTC4162_write_register(chip, LTC4162_INPUT_UNDERVOLTAGE_SETTING, LTC4162_VIN_UVCL_FIX2U(solar->vbat_mv + 2000));
+}
+
+void LTC4162_solar_init(LTC4162_solar_t *solar, uint8_t dropout_percent)
+{
+  solar->state = LTC4162_SOLAR_IDLE;
+  solar->dropout_percent = dropout_percent;
+  solar->solar_panel = 0;
+  solar->measured = 0;
+  solar->vbat_mv = 0;
+  solar->vinoc_mv = 0;
+  solar->ibat_near_open = 0;
+  solar->probes = 0;
+  solar->aborts = 0;
+}
+
+int LTC4162_solar_start(LTC4162_solar_t *solar, LTC4162_chip_cfg_t *chip, uint32_t now_ms)
+{
+  int failure = LTC4162_write_register(chip, LTC4162_MPPT_EN, 0);
+  if (!failure) failure = LTC4162_write_register(chip, LTC4162_INPUT_UNDERVOLTAGE_SETTING, LTC4162_VIN_UVCL_R2U(36));
+  solar->measured = 0;
+  solar->step_ms = now_ms;
+  solar->state = failure ? LTC4162_SOLAR_IDLE : LTC4162_SOLAR_OPEN_CIRCUIT;
+  return failure;
+}
+
+LTC4162_solar_state_t LTC4162_solar_step(LTC4162_solar_t *solar, LTC4162_chip_cfg_t *chip, uint32_t now_ms, uint8_t input_power)
+{
+  static const uint16_t wait_ms[] = {0, LTC4162_SOLAR_OPEN_CIRCUIT_MS, LTC4162_SOLAR_BATTERY_DETECT_MS, LTC4162_SOLAR_CURRENT_MS, LTC4162_SOLAR_CURRENT_MS};
+  uint16_t data;
+  int16_t ibat;
+  if (solar->state == LTC4162_SOLAR_IDLE) return LTC4162_SOLAR_IDLE;
+  if (!input_power)
+  {
+    LTC4162_solar_abort(solar, chip);
+    return LTC4162_SOLAR_IDLE;
+  }
+  if (now_ms - solar->step_ms < wait_ms[solar->state]) return (LTC4162_solar_state_t)solar->state;
+  solar->step_ms = now_ms;
+  switch (solar->state)
+  {
+    case LTC4162_SOLAR_OPEN_CIRCUIT:
+      if (measure_battery(solar, chip) || LTC4162_read_register(chip, LTC4162_VIN, &data)) break;
+      solar->vinoc_mv = LTC4162_VIN_FORMAT_I2FIX(data);
+      if (regulate_above_battery(solar, chip)) break;
+      solar->state = LTC4162_SOLAR_BATTERY_DETECT;
+      return LTC4162_SOLAR_BATTERY_DETECT;
+    case LTC4162_SOLAR_BATTERY_DETECT:
+      if (LTC4162_write_register(chip, LTC4162_INPUT_UNDERVOLTAGE_SETTING, LTC4162_VIN_UVCL_FIX2U(solar->vinoc_mv * solar->dropout_percent / 100))) break;
+      solar->state = LTC4162_SOLAR_NEAR_OPEN;
+      return LTC4162_SOLAR_NEAR_OPEN;
+    case LTC4162_SOLAR_NEAR_OPEN:
+      if (LTC4162_read_register(chip, LTC4162_IBAT, &data)) break;
+      solar->ibat_near_open = (int16_t)data;
+      if (regulate_above_battery(solar, chip)) break;
+      solar->state = LTC4162_SOLAR_LOADED;
+      return LTC4162_SOLAR_LOADED;
+    case LTC4162_SOLAR_LOADED:
+      if (LTC4162_read_register(chip, LTC4162_IBAT, &data)) break;
+      ibat = (int16_t)data;
+      solar->solar_panel = (int32_t)ibat * 20 > (int32_t)solar->ibat_near_open * 21;   // More than 5% up
+      if (solar->solar_panel) LTC4162_write_register(chip, LTC4162_MPPT_EN, 1);
+      solar->probes++;
+      solar->state = LTC4162_SOLAR_IDLE;
+      return LTC4162_SOLAR_IDLE;
+  }
+  LTC4162_solar_abort(solar, chip);   // A failed transaction: retrying a step could read a current that has moved on
+  return LTC4162_SOLAR_IDLE;
+}
+
+void LTC4162_solar_abort(LTC4162_solar_t *solar, LTC4162_chip_cfg_t *chip)
+{
+  if (solar->state == LTC4162_SOLAR_IDLE) return;
+  solar->state = LTC4162_SOLAR_IDLE;
+  solar->solar_panel = 0;
+  solar->aborts++;
+  if (solar->measured || !measure_battery(solar, chip))
+    regulate_above_battery(solar, chip);
+}
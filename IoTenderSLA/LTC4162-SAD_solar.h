@@ -0,0 +1,149 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-S is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters as well as numerous system status
+alerts. The LTC4162-S can charge from one to four 6V Lead-Acid batteries or one
+to two 12V Lead-Acid batteries with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-S is
+available in an I²C adjustable version as well a fixed voltage version both with
+and without MPPT enabled by default. The LTC4162-S is available in the 28-pin
+4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date$
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-SAD
+ *  @brief LTC4162-SAD non-blocking solar panel detection.
+ *
+ *  Tells a solar panel from a low impedance source such as a wall adapter by how the battery current responds to
+ *  the input undervoltage setting. With undervoltage regulation held just below the open circuit input voltage, a
+ *  panel can deliver little current; with it lowered to the battery voltage plus 2V, the panel delivers much more.
+ *  A stiff source delivers the same current either way. A panel is left with MPPT enabled, anything else with
+ *  undervoltage regulation at the battery voltage plus 2V.
+ *
+ *  The probe waits for the input to settle between steps, for about 2.75s in all. Rather than wait in place, it is
+ *  a state machine: @ref LTC4162_solar_step carries out a step once its wait has elapsed and returns at once
+ *  otherwise, so the main loop keeps serving the web page and LEDs throughout. A probe abandoned because input
+ *  power went away leaves undervoltage regulation as the low impedance result would.
+ *
+ *  Time comes from the caller, millis() on the ESP8266, so that a host build can step the probe on a virtual clock.
+ */
+
+#ifndef LTC4162_SOLAR_H_
+#define LTC4162_SOLAR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "LTC4162-SAD.h"
+
+#define LTC4162_SOLAR_OPEN_CIRCUIT_MS 250      //!< Wait for VIN to rise to open circuit with the charger held off
+#define LTC4162_SOLAR_BATTERY_DETECT_MS 2000   //!< Wait for the LTC4162 to get through battery detection
+#define LTC4162_SOLAR_CURRENT_MS 250           //!< Wait for the battery current to settle after each undervoltage change
+
+  /*! Probe steps, each named for what it is waiting on. */
+  typedef enum
+  {
+    LTC4162_SOLAR_IDLE,           //!< No probe running
+    LTC4162_SOLAR_OPEN_CIRCUIT,   //!< Charger held off by a 36V undervoltage setting, VIN rising to open circuit
+    LTC4162_SOLAR_BATTERY_DETECT, //!< Charging with undervoltage at the battery voltage plus 2V
+    LTC4162_SOLAR_NEAR_OPEN,      //!< Undervoltage at dropout_percent of open circuit, battery current settling
+    LTC4162_SOLAR_LOADED          //!< Undervoltage back at the battery voltage plus 2V, battery current settling
+  } LTC4162_solar_state_t;
+
+  /*! One probe in progress, and the outcome of the last one finished. */
+  typedef struct
+  {
+    uint8_t state;            //!< LTC4162_solar_state_t
+    uint8_t dropout_percent;  //!< Undervoltage setting for the near open circuit measurement, percent of open circuit VIN
+    uint8_t solar_panel;      //!< Non-zero if the last probe finished found a solar panel
+    uint8_t measured;         //!< Non-zero once vbat_mv holds this probe's battery voltage
+    uint32_t step_ms;         //!< When the current step began
+    int32_t vbat_mv;          //!< Battery stack voltage with the charger held off
+    int32_t vinoc_mv;         //!< Open circuit input voltage
+    int16_t ibat_near_open;   //!< Battery current code with undervoltage near open circuit
+    uint32_t probes;          //!< Probes finished
+    uint32_t aborts;          //!< Probes abandoned, for loss of input power or a failed transaction
+  } LTC4162_solar_t;
+
+  /*! Prepares an idle detector. The result reads as not a solar panel until a probe finishes. */
+  void LTC4162_solar_init(LTC4162_solar_t *solar,   //!< Detector to initialize
+                          uint8_t dropout_percent   //!< Near open circuit undervoltage setting, percent of open circuit VIN
+                         );
+  /*! Begins a probe: disables MPPT and holds the charger off so VIN can rise to open circuit. A probe already running
+      is started over. Returns 0 on success, otherwise the error code from the SMBus functions. */
+  int LTC4162_solar_start(LTC4162_solar_t *solar,   //!< Detector
+                          LTC4162_chip_cfg_t *chip, //!< Pointer to chip configuration struct
+                          uint32_t now_ms           //!< Current time
+                         );
+  /*! Advances a running probe by at most one step, without waiting. Abandons it through @ref LTC4162_solar_abort if
+      input power has gone. Returns the state after the call, LTC4162_SOLAR_IDLE once the probe is over. */
+  LTC4162_solar_state_t LTC4162_solar_step(LTC4162_solar_t *solar,   //!< Detector
+                                           LTC4162_chip_cfg_t *chip, //!< Pointer to chip configuration struct
+                                           uint32_t now_ms,          //!< Current time
+                                           uint8_t input_power       //!< Non-zero while VIN_GT_VBAT
+                                          );
+  /*! Abandons a running probe, leaving MPPT off and undervoltage regulation at the battery voltage plus 2V, and
+      records the input as not a solar panel. Does nothing when idle. */
+  void LTC4162_solar_abort(LTC4162_solar_t *solar,   //!< Detector
+                           LTC4162_chip_cfg_t *chip  //!< Pointer to chip configuration struct
+                          );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LTC4162_SOLAR_H_ */
@@ -0,0 +1,1406 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-S is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters as well as numerous system status
+alerts. The LTC4162-S can charge from one to four 6V Lead-Acid batteries or one
+to two 12V Lead-Acid batteries with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-S is
+available in an I²C adjustable version as well a fixed voltage version both with
+and without MPPT enabled by default. The LTC4162-S is available in the 28-pin
+4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date$
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+/*! @file
+ *  @ingroup LTC4162-SAD
+ *  @brief LTC4162-SAD host regression tests.
+ *
+ *  Checks the CRC-8 and PEC functions against golden vectors and a bitwise reference and the captured frame PEC
+ *  verifier on both its paths, and the fixed point conversion macros both ways, fixed point and duration text, the
+ *  thermistor table and the bulk log conversions against their floating point counterparts, then runs the driver
+ *  against the register level simulator in LTC4162-SAD_sim.cpp: word and bit field reads and writes, telemetry
+ *  snapshots with and without register list reads, the telemetry history ring, bit fields gathered one read per
+ *  register, the C++ field types against the C API, the bus transactions the write cache saves and when it reads
+ *  again, the simulator's access rules, alert reading and clearing, the ship mode key and corrupted PEC bytes in
+ *  both directions, and the transaction queue serviced against it. The event queue is filled past its size, wrapped
+ *  and then run with a producer and a consumer thread. Last, the scheduler's miss, overrun and lateness accounting
+ *  on a virtual clock, ten minutes of the sketch's task table, and the solar panel detection probe against simulated
+ *  panel, wall adapter and long cable I-V curves with the sketch's limits task running alongside, and ten minutes of
+ *  exception polling through the alert limit windows against a simulated charge. Each failed check is printed with
+ *  its line. The exit status is non-zero if any check failed.
+ *
+ *  Build and run from this folder, once as is and once each with -DLTC4162_CRC_TABLE, -DLTC4162_CRC_SLICE=4 and
+ *  -DLTC4162_CRC_SLICE=8 so every CRC implementation is checked:
+ *
+ *    g++ -O2 -Wall -pthread -o test LTC4162-SAD_test.cpp LTC4162-SAD_sim.cpp -x c LTC4162-SAD.c \
+ *        LTC4162-SAD_pec.c LTC4162-SAD_ntc.c LTC4162-SAD_bulk.c LTC4162-SAD_queue.c \
+ *        LTC4162-SAD_event.c LTC4162-SAD_sched.c LTC4162-SAD_solar.c LTC4162-SAD_window.c \
+ *        LTC4162-SAD_trace.c LTC4162-SAD_fmt.c LTC4162-SAD_history.c
+ *    ./test
+ *
+ *  Not compiled in the Arduino environment.
+ */
+
+#ifndef ARDUINO
+
+#include "LTC4162-SAD.h"
+#include "LTC4162-SAD_formats.h"
+#include "LTC4162-SAD_bulk.h"
+#include "LTC4162-SAD_event.h"
+#include "LTC4162-SAD_fields.hpp"
+#include "LTC4162-SAD_fmt.h"
+#include "LTC4162-SAD_history.h"
+#include "LTC4162-SAD_ntc.h"
+#include "LTC4162-SAD_pec.h"
+#include "LTC4162-SAD_queue.h"
+#include "LTC4162-SAD_sched.h"
+#include "LTC4162-SAD_solar.h"
+#include "LTC4162-SAD_trace.h"
+#include "LTC4162-SAD_window.h"
+#include "LTC4162-SAD_sim.h"
+#include <algorithm>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+
+static unsigned checks, failures;
+
+/* Records one check, printing it if it failed. */
+static void check(bool passed, const char *condition, int line)
+{
+  checks++;
+  if (passed) return;
+  failures++;
+  printf("FAIL line %d: %s\n", line, condition);
+}
+#define CHECK(condition) check((condition), #condition, __LINE__)
+/* As CHECK for two integers, printing both values if they differ. */
+#define CHECK_EQUAL(actual, expected) \
+  do \
+  { \
+    long actual_value = (long)(actual), expected_value = (long)(expected); \
+    check(actual_value == expected_value, #actual " == " #expected, __LINE__); \
+    if (actual_value != expected_value) printf("  got %ld (0x%lX), expected %ld (0x%lX)\n", actual_value, actual_value, expected_value, expected_value); \
+  } while (0)
+/* Checks the reads and writes sim has seen since bus_reads and bus_writes were last set, then sets them. */
+#define CHECK_BUS(sim, expected_reads, expected_writes) \
+  do \
+  { \
+    CHECK_EQUAL((sim).reads - bus_reads, expected_reads); \
+    CHECK_EQUAL((sim).writes - bus_writes, expected_writes); \
+    bus_reads = (sim).reads; \
+    bus_writes = (sim).writes; \
+  } while (0)
+
+/* The selected CRC-8 implementation against golden vectors and a bit at a time reference, for every length and
+   alignment a slicing loop can see. */
+static void test_pec()
+{
+  uint8_t data[80];
+  CHECK_EQUAL(pec_self_test(), 0);
+  for (unsigned i = 0; i < sizeof(data); i++) data[i] = (uint8_t)(i * 151 + 7);
+  for (unsigned start = 0; start < 8; start++)
+  {
+    uint8_t reference = 0x5A;
+    for (unsigned length = 0; start + length <= sizeof(data); length++)
+    {
+      CHECK_EQUAL(pec_block(data + start, length, 0x5A), reference);
+      if (start + length == sizeof(data)) break;
+      reference ^= data[start + length];
+      for (int bit = 0; bit < 8; bit++) reference = (uint8_t)(reference & 0x80 ? (reference << 1) ^ 0x07 : reference << 1);
+    }
+  }
+}
+
+/* Captured frames with their PEC computed by pec_block() over the bytes in bus order, reads and writes mixed at random. */
+static void make_trace(LTC4162_trace_frame_t *frames, size_t count, uint32_t seed)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    seed = seed * 1664525 + 1013904223;
+    LTC4162_trace_frame_t *frame = &frames[i];
+    frame->address = (uint8_t)(seed >> 25);
+    frame->command_code = (uint8_t)(seed >> 17);
+    frame->read = (uint8_t)(seed >> 16 & 1);
+    seed = seed * 1664525 + 1013904223;
+    frame->data = (uint16_t)(seed >> 16);
+    uint8_t bytes[6], length = 0;
+    bytes[length++] = (uint8_t)(frame->address << 1);
+    bytes[length++] = frame->command_code;
+    if (frame->read) bytes[length++] = (uint8_t)(frame->address << 1 | 1);
+    bytes[length++] = (uint8_t)(frame->data & 0xFF);
+    bytes[length++] = (uint8_t)(frame->data >> 8);
+    frame->pec = pec_block(bytes, length, 0);
+  }
+}
+
+/* Both verification paths accept every good frame and reject every single bit error in the PEC, over batch lengths
+   that are not multiples of any vector width. */
+static void test_trace()
+{
+  static LTC4162_trace_frame_t frames[1001];
+  static uint8_t failures[1001];
+  for (int clmul = 1; clmul >= 0; clmul--)
+  {
+    CHECK(LTC4162_trace_clmul(clmul) <= clmul);   // Never on when disabled
+    for (size_t count = 0; count <= 9; count++)
+    {
+      make_trace(frames, count, (uint32_t)count);
+      CHECK_EQUAL(LTC4162_trace_verify(frames, count, NULL), 0);
+    }
+    make_trace(frames, 1001, 1);
+    memset(failures, 0xEE, sizeof(failures));
+    CHECK_EQUAL(LTC4162_trace_verify(frames, 1001, failures), 0);
+    CHECK(std::count(failures, failures + 1001, 0) == 1001);
+
+    for (size_t i = 0; i < 1001; i++) frames[i].pec ^= (uint8_t)(1 << (i % 8));
+    for (size_t i = 0; i < 1001; i += 3) frames[i].pec ^= (uint8_t)(1 << (i % 8));   // Repaired again
+    memset(failures, 0xEE, sizeof(failures));
+    CHECK_EQUAL(LTC4162_trace_verify(frames, 1001, failures), 1001 - 334);
+    unsigned wrong = 0;
+    for (size_t i = 0; i < 1001; i++) wrong += failures[i] != (i % 3 != 0);
+    CHECK_EQUAL(wrong, 0);
+    CHECK_EQUAL(LTC4162_trace_verify(frames + 1, 7, NULL), 5);   // Unaligned start, odd length
+
+    make_trace(frames, 1001, 2);
+    frames[500].read ^= 1;                                      // A write mistaken for a read, or the reverse
+    frames[1000].data ^= 0x0100;
+    CHECK_EQUAL(LTC4162_trace_verify(frames, 1001, failures), 2);
+    CHECK(failures[500] && failures[1000]);
+  }
+  LTC4162_trace_clmul(1);
+}
+
+/* Fixed point and duration text, with the returned pointer at the terminating NUL. */
+static void test_fmt()
+{
+  static const struct
+  {
+    int32_t value;
+    uint8_t scale, decimals;
+    const char *unit, *expected;
+  } fixes[] =
+  {
+    {3700, 3, 3, "V", "3.700V"},
+    {3700, 3, 1, NULL, "3.7"},
+    {3750, 3, 1, NULL, "3.8"},          // Half away from zero
+    {-3750, 3, 1, NULL, "-3.8"},
+    {3749, 3, 1, NULL, "3.7"},
+    {-5, 4, 3, NULL, "-0.001"},
+    {-4, 4, 3, NULL, "0.000"},          // Rounds to zero, no "-0"
+    {-499, 3, 0, NULL, "0"},
+    {-500, 3, 0, NULL, "-1"},
+    {-1, 0, 0, NULL, "-1"},
+    {0, 0, 0, NULL, "0"},
+    {5, 1, 3, NULL, "0.500"},           // Zero padded beyond the scale
+    {12, 0, 2, " ms", "12.00 ms"},
+    {-12, 1, 4, NULL, "-1.2000"},
+    {1, 0, 12, NULL, "1.000000000"},    // At most 9 decimals
+    {INT32_MIN, 0, 0, NULL, "-2147483648"},
+    {INT32_MIN, 3, 3, NULL, "-2147483.648"},
+    {INT32_MIN, 0, 9, NULL, "-2147483648.000000000"},
+    {INT32_MIN, 9, 0, NULL, "-2"},
+    {INT32_MAX, 9, 9, NULL, "2.147483647"},
+    {INT32_MIN, 10, 0, NULL, "0"},      // Rounding 10 or more places always gives zero
+    {INT32_MAX, 12, 1, NULL, "0.0"},
+    {INT32_MAX, 255, 9, NULL, "0.000000000"},
+  };
+  static const struct
+  {
+    uint32_t seconds;
+    const char *expected;
+  } durations[] =
+  {
+    {0, "0h 0m 0s"},
+    {59, "0h 0m 59s"},
+    {3661, "1h 1m 1s"},
+    {86399, "23h 59m 59s"},
+    {UINT32_MAX, "1193046h 28m 15s"},
+  };
+  char text[LTC4162_FMT_SIZE + 8];
+  for (unsigned i = 0; i < sizeof(fixes) / sizeof(fixes[0]); i++)
+  {
+    char *end = LTC4162_fmt_fix(text, fixes[i].value, fixes[i].scale, fixes[i].decimals, fixes[i].unit);
+    check(strcmp(text, fixes[i].expected) == 0, fixes[i].expected, __LINE__);
+    CHECK(end == text + strlen(text));
+  }
+  for (unsigned i = 0; i < sizeof(durations) / sizeof(durations[0]); i++)
+  {
+    char *end = LTC4162_fmt_duration(text, durations[i].seconds);
+    check(strcmp(text, durations[i].expected) == 0, durations[i].expected, __LINE__);
+    CHECK(end == text + strlen(text));
+  }
+}
+
+/* Every fixed point register to real macro is within one unit of the rounded floating point macro over every register
+   value. */
+#define CHECK_FIX(FIX, R, UNIT) \
+  { \
+    long worst = 0; \
+    for (long y = 0; y < 65536; y++) worst = std::max(worst, labs((long)FIX(y) - lround(R(y) * (UNIT)))); \
+    check(worst <= 1, #FIX " within 1 of " #R, __LINE__); \
+  }
+
+/* Every fixed point to register macro equals the real to register macro over the register range, less a margin where
+   the real macro's cast wraps, but for a one code difference where the value sits exactly on a rounding boundary.
+   Beyond the range it saturates. */
+#define CHECK_FIX2(FIX2, R2, FIX, UNIT, MIN, MAX) \
+  { \
+    long mismatches = 0; \
+    for (long x = FIX((MIN) + 16); x <= FIX((MAX) - 16); x++) \
+    { \
+      long difference = (long)FIX2(x) - (long)R2(x / (double)(UNIT)); \
+      if (difference && (labs(difference) > 1 || R2((x - 0.01) / (UNIT)) == R2((x + 0.01) / (UNIT)))) mismatches++; \
+    } \
+    check(mismatches == 0, #FIX2 " matches " #R2, __LINE__); \
+    check(FIX2(INT32_MIN) == (MIN) && FIX2(INT32_MAX) == (MAX), #FIX2 " saturates", __LINE__); \
+  }
+
+static void test_fix()
+{
+  CHECK_FIX(LTC4162_IINLIM_U2FIX, LTC4162_IINLIM_U2R, LTC4162_MILLI)
+  CHECK_FIX(LTC4162_VCHARGE_SLA_U2FIX, LTC4162_VCHARGE_SLA_U2R, LTC4162_MILLI)
+  CHECK_FIX(LTC4162_VABSORB_SLA_DELTA_U2FIX, LTC4162_VABSORB_SLA_DELTA_U2R, LTC4162_MILLI)
+  CHECK_FIX(LTC4162_VIN_UVCL_U2FIX, LTC4162_VIN_UVCL_U2R, LTC4162_MILLI)
+  CHECK_FIX(LTC4162_ICHARGE_U2FIX, LTC4162_ICHARGE_U2R, LTC4162_MILLI)
+  CHECK_FIX(LTC4162_VBAT_SLA_FORMAT_I2FIX, LTC4162_VBAT_SLA_FORMAT_I2R, LTC4162_MILLI)
+  CHECK_FIX(LTC4162_IBAT_FORMAT_I2FIX, LTC4162_IBAT_FORMAT_I2R, LTC4162_MILLI)
+  CHECK_FIX(LTC4162_VOUT_FORMAT_I2FIX, LTC4162_VOUT_FORMAT_I2R, LTC4162_MILLI)
+  CHECK_FIX(LTC4162_VIN_FORMAT_I2FIX, LTC4162_VIN_FORMAT_I2R, LTC4162_MILLI)
+  CHECK_FIX(LTC4162_IIN_FORMAT_I2FIX, LTC4162_IIN_FORMAT_I2R, LTC4162_MILLI)
+  CHECK_FIX(LTC4162_BSR_FORMAT_SLA_U2FIX, LTC4162_BSR_FORMAT_SLA_U2R, LTC4162_MICRO)
+  CHECK_FIX(LTC4162_DIE_TEMP_FORMAT_I2FIX, LTC4162_DIE_TEMP_FORMAT_I2R, LTC4162_MILLI)
+  CHECK_FIX2(LTC4162_IINLIM_FIX2U, LTC4162_IINLIM_R2U, LTC4162_IINLIM_U2FIX, LTC4162_MILLI, 0, 65535)
+  CHECK_FIX2(LTC4162_VCHARGE_SLA_FIX2U, LTC4162_VCHARGE_SLA_R2U, LTC4162_VCHARGE_SLA_U2FIX, LTC4162_MILLI, 0, 65535)
+  CHECK_FIX2(LTC4162_VABSORB_SLA_DELTA_FIX2U, LTC4162_VABSORB_SLA_DELTA_R2U, LTC4162_VABSORB_SLA_DELTA_U2FIX, LTC4162_MILLI, 0, 65535)
+  CHECK_FIX2(LTC4162_VIN_UVCL_FIX2U, LTC4162_VIN_UVCL_R2U, LTC4162_VIN_UVCL_U2FIX, LTC4162_MILLI, 0, 65535)
+  CHECK_FIX2(LTC4162_ICHARGE_FIX2U, LTC4162_ICHARGE_R2U, LTC4162_ICHARGE_U2FIX, LTC4162_MILLI, 0, 65535)
+  CHECK_FIX2(LTC4162_VBAT_SLA_FORMAT_FIX2I, LTC4162_VBAT_SLA_FORMAT_R2I, LTC4162_VBAT_SLA_FORMAT_I2FIX, LTC4162_MILLI, -32768, 32767)
+  CHECK_FIX2(LTC4162_IBAT_FORMAT_FIX2I, LTC4162_IBAT_FORMAT_R2I, LTC4162_IBAT_FORMAT_I2FIX, LTC4162_MILLI, -32768, 32767)
+  CHECK_FIX2(LTC4162_VOUT_FORMAT_FIX2I, LTC4162_VOUT_FORMAT_R2I, LTC4162_VOUT_FORMAT_I2FIX, LTC4162_MILLI, -32768, 32767)
+  CHECK_FIX2(LTC4162_VIN_FORMAT_FIX2I, LTC4162_VIN_FORMAT_R2I, LTC4162_VIN_FORMAT_I2FIX, LTC4162_MILLI, -32768, 32767)
+  CHECK_FIX2(LTC4162_IIN_FORMAT_FIX2I, LTC4162_IIN_FORMAT_R2I, LTC4162_IIN_FORMAT_I2FIX, LTC4162_MILLI, -32768, 32767)
+  CHECK_FIX2(LTC4162_BSR_FORMAT_SLA_FIX2U, LTC4162_BSR_FORMAT_SLA_R2U, LTC4162_BSR_FORMAT_SLA_U2FIX, LTC4162_MICRO, 0, 65535)
+  CHECK_FIX2(LTC4162_DIE_TEMP_FORMAT_FIX2I, LTC4162_DIE_TEMP_FORMAT_R2I, LTC4162_DIE_TEMP_FORMAT_I2FIX, LTC4162_MILLI, -32768, 32767)
+}
+
+/* The thermistor table against the nested ternary macros: within 12 millidegrees from the first breakpoint up to 126C,
+   and within 30 above that and along the extrapolated end segments, where a code spans the most temperature and the
+   rounding of the breakpoint codes shows most. One code on the way back over the -40C to 150C span the macros cover. */
+static void test_ntc()
+{
+  const LTC4162_ntc_curve_t *curve = &LTC4162_ntcs0402e3103flt;
+  int16_t cold = curve->points[0].code, warm = (int16_t)LTC4162_NTCS0402E3103FLT_R2I(126);
+  double inside = 0, outside = 0;
+  for (long y = -32768; y < 32768; y++)
+  {
+    double error = fabs(LTC4162_ntc_i2fix(curve, (int16_t)y) - LTC4162_NTCS0402E3103FLT_I2R(y) * 1000);
+    if (y <= cold && y >= warm) inside = std::max(inside, error);
+    else outside = std::max(outside, error);
+  }
+  CHECK(inside <= 12);
+  CHECK(outside <= 30);
+  long worst = 0;
+  for (long t = -40000; t <= 150000; t++) worst = std::max(worst, labs(LTC4162_ntc_fix2i(curve, t) - (long)LTC4162_NTCS0402E3103FLT_R2I(t / 1000.0)));
+  CHECK(worst <= 1);
+}
+
+/* Every register value through one bulk channel, with the AVX2 kernels where the processor has them and with the
+   scalar loop, against the formats macro. Single precision leaves the result within 1% of one code's step. */
+static int16_t bulk_raw[65536];
+static float bulk_out[65536];
+
+#define CHECK_BULK(CHANNEL, I2R, TYPE, MULTIPLIER) \
+  for (int avx2 = 1; avx2 >= 0; avx2--) \
+  { \
+    if (LTC4162_bulk_avx2(avx2) != avx2) continue; \
+    double worst = 0; \
+    LTC4162_bulk_convert(CHANNEL, bulk_raw, bulk_out, 65536, BULK_CELL_COUNT); \
+    for (long y = 0; y < 65536; y++) \
+    { \
+      long code = (TYPE)bulk_raw[y], neighbour = (TYPE)(code + 1) > code ? code + 1 : code - 1; \
+      double expected = I2R(code) * (MULTIPLIER); \
+      worst = std::max(worst, fabs(bulk_out[y] - expected) / fabs(I2R(neighbour) * (MULTIPLIER) - expected)); \
+    } \
+    check(worst <= 0.01, #CHANNEL " within 1% of a code", __LINE__); \
+  }
+
+#define BULK_CELL_COUNT 4
+static void test_bulk()
+{
+  for (long y = 0; y < 65536; y++) bulk_raw[y] = (int16_t)(y - 32768);
+  CHECK_BULK(LTC4162_BULK_VBAT, LTC4162_VBAT_SLA_FORMAT_I2R, int16_t, BULK_CELL_COUNT / 2)
+  CHECK_BULK(LTC4162_BULK_IBAT, LTC4162_IBAT_FORMAT_I2R, int16_t, 1)
+  CHECK_BULK(LTC4162_BULK_VOUT, LTC4162_VOUT_FORMAT_I2R, int16_t, 1)
+  CHECK_BULK(LTC4162_BULK_VIN, LTC4162_VIN_FORMAT_I2R, int16_t, 1)
+  CHECK_BULK(LTC4162_BULK_IIN, LTC4162_IIN_FORMAT_I2R, int16_t, 1)
+  CHECK_BULK(LTC4162_BULK_DIE_TEMP, LTC4162_DIE_TEMP_FORMAT_I2R, int16_t, 1)
+  CHECK_BULK(LTC4162_BULK_THERMISTOR, LTC4162_NTCS0402E3103FLT_I2R, int16_t, 1)
+  CHECK_BULK(LTC4162_BULK_BSR, LTC4162_BSR_FORMAT_SLA_U2R, uint16_t, BULK_CELL_COUNT / 2)
+  LTC4162_bulk_avx2(1);
+}
+
+/* Word and bit field reads and writes through the driver, against the simulator's access rules. */
+static void test_sim_registers()
+{
+  LTC4162_sim sim;
+  LTC4162_chip_cfg_t chip = {};
+  uint16_t data;
+  sim.attach(&chip);
+
+  CHECK_EQUAL(LTC4162_read_word(&chip, LTC4162_THERMAL_REG_START_TEMP_REG_SUBADDR, &data), 0);
+  CHECK_EQUAL(data, sim.get(LTC4162_THERMAL_REG_START_TEMP_REG_SUBADDR));     // Power-on default
+  sim.set(LTC4162_VBAT_REG_SUBADDR, 0x1234);
+  CHECK_EQUAL(LTC4162_read_register(&chip, LTC4162_VBAT, &data), 0);
+  CHECK_EQUAL(data, 0x1234);
+
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_SUSPEND_CHARGER, 1), 0);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_FORCE_TELEMETRY_ON, 1), 0);
+  CHECK_EQUAL(sim.get(LTC4162_CONFIG_BITS_REG_SUBADDR), LTC4162_SUSPEND_CHARGER_MASK | LTC4162_FORCE_TELEMETRY_ON_MASK);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_SUSPEND_CHARGER, 0), 0);   // The other field is kept
+  CHECK_EQUAL(sim.get(LTC4162_CONFIG_BITS_REG_SUBADDR), LTC4162_FORCE_TELEMETRY_ON_MASK);
+  CHECK_EQUAL(LTC4162_read_register(&chip, LTC4162_FORCE_TELEMETRY_ON, &data), 0);
+  CHECK_EQUAL(data, 1);
+
+  CHECK_EQUAL(LTC4162_write_bits(&chip, LTC4162_IIN_LIMIT_TARGET_REG_SUBADDR, UINT16_MAX, UINT16_MAX), 0);
+  CHECK_EQUAL(sim.get(LTC4162_IIN_LIMIT_TARGET_REG_SUBADDR), LTC4162_IIN_LIMIT_TARGET_MASK);  // Unimplemented bits stay 0
+  CHECK_EQUAL(LTC4162_write_bits(&chip, LTC4162_VBAT_REG_SUBADDR, UINT16_MAX, 0x4321), 0);
+  CHECK_EQUAL(sim.get(LTC4162_VBAT_REG_SUBADDR), 0x1234);                      // Read only
+  CHECK_EQUAL(LTC4162_write_register_policy(&chip, LTC4162_VBAT, 0x4321, LTC4162_WRITE_VERIFY_READBACK), LTC4162_VERIFY_FAILED);
+
+  chip.address = LTC4162_ADDR_68 + 1;
+  CHECK_EQUAL(LTC4162_read_register(&chip, LTC4162_VBAT, &data), LTC4162_sim::NACK);
+  CHECK_EQUAL(sim.nacks, 1);
+}
+
+/* Alert bits clear when written 0 and are left alone when written 1, and ship mode only arms on its key. */
+static void test_sim_alerts_and_ship_mode()
+{
+  LTC4162_sim sim;
+  LTC4162_chip_cfg_t chip = {};
+  sim.attach(&chip);
+
+  sim.set(LTC4162_LIMIT_ALERTS_REG_SUBADDR, LTC4162_VBAT_LO_ALERT_MASK | LTC4162_VIN_HI_ALERT_MASK);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_VBAT_LO_ALERT, 0), 0);     // Read, modify, write back
+  CHECK_EQUAL(sim.get(LTC4162_LIMIT_ALERTS_REG_SUBADDR), LTC4162_VIN_HI_ALERT_MASK);
+  CHECK_EQUAL(LTC4162_write_bits(&chip, LTC4162_LIMIT_ALERTS_REG_SUBADDR, UINT16_MAX, UINT16_MAX), 0);
+  CHECK_EQUAL(sim.get(LTC4162_LIMIT_ALERTS_REG_SUBADDR), LTC4162_VIN_HI_ALERT_MASK);   // Writing 1 sets nothing
+  CHECK_EQUAL(LTC4162_write_bits(&chip, LTC4162_LIMIT_ALERTS_REG_SUBADDR, UINT16_MAX, 0), 0);
+  CHECK_EQUAL(sim.get(LTC4162_LIMIT_ALERTS_REG_SUBADDR), 0);
+
+  /* An alert raised between reading and clearing survives the clear. */
+  LTC4162_alerts_t enable = {0, 0x1FFF, 0x3F}, alerts;
+  CHECK_EQUAL(LTC4162_enable_alerts(&chip, &enable), 0);
+  CHECK(sim.get(LTC4162_EN_CHARGER_STATE_ALERTS_REG_SUBADDR) & LTC4162_EN_CC_CV_CHARGE_ALERT_MASK);
+  sim.set(LTC4162_CHARGER_STATE_ALERTS_REG_SUBADDR, LTC4162_CC_CV_CHARGE_ALERT_MASK);
+  sim.set(LTC4162_CHARGE_STATUS_ALERTS_REG_SUBADDR, LTC4162_CONSTANT_VOLTAGE_ALERT_MASK);
+  CHECK_EQUAL(LTC4162_read_alerts(&chip, &alerts), 0);
+  CHECK_EQUAL(alerts.limit, 0);
+  CHECK_EQUAL(alerts.charger_state, LTC4162_CC_CV_CHARGE_ALERT_MASK);
+  CHECK_EQUAL(alerts.charge_status, LTC4162_CONSTANT_VOLTAGE_ALERT_MASK);
+  sim.set(LTC4162_CHARGER_STATE_ALERTS_REG_SUBADDR, LTC4162_CC_CV_CHARGE_ALERT_MASK | LTC4162_CHARGER_SUSPENDED_ALERT_MASK);
+  unsigned writes = sim.writes;
+  CHECK_EQUAL(LTC4162_clear_alerts(&chip, &alerts), 0);
+  CHECK_EQUAL(sim.writes - writes, 2);                                            // Nothing to clear in the limit register
+  CHECK_EQUAL(sim.get(LTC4162_CHARGER_STATE_ALERTS_REG_SUBADDR), LTC4162_CHARGER_SUSPENDED_ALERT_MASK);
+  CHECK_EQUAL(sim.get(LTC4162_CHARGE_STATUS_ALERTS_REG_SUBADDR), 0);
+
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_ARM_SHIP_MODE, LTC4162_ARM_SHIP_MODE_ENUM_ARM ^ 1), 0);
+  CHECK(!sim.ship_mode_armed());
+  CHECK_EQUAL(LTC4162_write_register_policy(&chip, LTC4162_ARM_SHIP_MODE, LTC4162_ARM_SHIP_MODE_ENUM_ARM, LTC4162_WRITE_VERIFY_READBACK), 0);
+  CHECK(sim.ship_mode_armed());
+  sim.power_on_reset();
+  CHECK(!sim.ship_mode_armed());
+}
+
+/* Every member of the telemetry snapshot and the register it is read from. */
+static const struct
+{
+  uint8_t command_code;
+  uint16_t LTC4162_telemetry_t::*member;
+} telemetry_layout[] =
+{
+  {LTC4162_TABSORBTIMER_REG_SUBADDR, &LTC4162_telemetry_t::tabsorbtimer},
+  {LTC4162_TEQUALIZETIMER_REG_SUBADDR, &LTC4162_telemetry_t::tequalizetimer},
+  {LTC4162_CHARGER_STATE_REG_SUBADDR, &LTC4162_telemetry_t::charger_state},
+  {LTC4162_CHARGE_STATUS_REG_SUBADDR, &LTC4162_telemetry_t::charge_status},
+  {LTC4162_SYSTEM_STATUS_REG_SUBADDR, &LTC4162_telemetry_t::system_status},
+  {LTC4162_VBAT_REG_SUBADDR, &LTC4162_telemetry_t::vbat},
+  {LTC4162_VIN_REG_SUBADDR, &LTC4162_telemetry_t::vin},
+  {LTC4162_VOUT_REG_SUBADDR, &LTC4162_telemetry_t::vout},
+  {LTC4162_IBAT_REG_SUBADDR, &LTC4162_telemetry_t::ibat},
+  {LTC4162_IIN_REG_SUBADDR, &LTC4162_telemetry_t::iin},
+  {LTC4162_DIE_TEMP_REG_SUBADDR, &LTC4162_telemetry_t::die_temp},
+  {LTC4162_THERMISTOR_VOLTAGE_REG_SUBADDR, &LTC4162_telemetry_t::thermistor_voltage},
+  {LTC4162_BSR_REG_SUBADDR, &LTC4162_telemetry_t::bsr},
+  {LTC4162_CHEM_CELLS_REG_SUBADDR, &LTC4162_telemetry_t::chem_cells},
+  {LTC4162_ICHARGE_DAC_REG_SUBADDR, &LTC4162_telemetry_t::icharge_dac},
+  {LTC4162_VCHARGE_DAC_REG_SUBADDR, &LTC4162_telemetry_t::vcharge_dac},
+  {LTC4162_IIN_LIMIT_DAC_REG_SUBADDR, &LTC4162_telemetry_t::iin_limit_dac},
+  {LTC4162_VBAT_FILT_REG_SUBADDR, &LTC4162_telemetry_t::vbat_filt},
+  {LTC4162_BSR_CHARGE_CURRENT_REG_SUBADDR, &LTC4162_telemetry_t::bsr_charge_current},
+  {LTC4162_TELEMETRY_STATUS_REG_SUBADDR, &LTC4162_telemetry_t::telemetry_status},
+  {LTC4162_INPUT_UNDERVOLTAGE_DAC_REG_SUBADDR, &LTC4162_telemetry_t::input_undervoltage_dac}
+};
+#define TELEMETRY_REGISTERS (sizeof(telemetry_layout) / sizeof(telemetry_layout[0]))
+
+/* Bus functions that fail reads of failing_command_code and otherwise pass through to the simulator. */
+static uint8_t failing_command_code;
+static int failing_read_register(uint8_t address, uint8_t command_code, uint16_t *data, struct port_configuration *pc)
+{
+  if (command_code == failing_command_code) return LTC4162_sim::NACK;
+  return LTC4162_sim::smbus_read_register(address, command_code, data, pc);
+}
+static int failing_read_register_list(uint8_t address, const uint8_t *command_codes, uint16_t *data, uint8_t count, struct port_configuration *pc)
+{
+  for (uint8_t i = 0; i < count; i++)
+  {
+    int failure = failing_read_register(address, command_codes[i], &data[i], pc);
+    if (failure) return failure;
+  }
+  return 0;
+}
+
+/* A snapshot fills every member from its own register and stamps it once, through read_register_list and without
+ * it, and a read failing part way through is returned with the snapshot left as it was. */
+static void test_read_telemetry()
+{
+  size_t members = sizeof(uint32_t) + TELEMETRY_REGISTERS * sizeof(uint16_t);
+  CHECK_EQUAL(sizeof(LTC4162_telemetry_t), (members + alignof(LTC4162_telemetry_t) - 1) / alignof(LTC4162_telemetry_t) *
+              alignof(LTC4162_telemetry_t));                              // No member left out of the layout
+  for (int list = 0; list < 2; list++)
+  {
+    LTC4162_sim sim;
+    LTC4162_chip_cfg_t chip = {};
+    LTC4162_telemetry_t telemetry, before;
+    sim.attach(&chip);
+    if (!list) chip.read_register_list = NULL;
+    for (unsigned i = 0; i < TELEMETRY_REGISTERS; i++)
+      sim.set(telemetry_layout[i].command_code, (uint16_t)(0x9E37 * (i + 1)));
+    memset(&telemetry, 0xEE, sizeof(telemetry));
+    uint32_t reads = sim.reads;
+    CHECK_EQUAL(LTC4162_read_telemetry(&chip, &telemetry, 123456), 0);
+    CHECK_EQUAL(sim.reads - reads, TELEMETRY_REGISTERS);
+    CHECK_EQUAL(telemetry.timestamp, 123456);
+    for (unsigned i = 0; i < TELEMETRY_REGISTERS; i++)
+      CHECK_EQUAL(telemetry.*telemetry_layout[i].member, sim.get(telemetry_layout[i].command_code));
+
+    before = telemetry;
+    chip.read_register = failing_read_register;
+    if (list) chip.read_register_list = failing_read_register_list;
+    failing_command_code = LTC4162_IBAT_REG_SUBADDR;
+    sim.set(LTC4162_VBAT_REG_SUBADDR, (uint16_t)(sim.get(LTC4162_VBAT_REG_SUBADDR) + 1));   // Read before the failure
+    CHECK_EQUAL(LTC4162_read_telemetry(&chip, &telemetry, 654321), LTC4162_sim::NACK);
+    CHECK(memcmp(&before, &telemetry, sizeof(telemetry)) == 0);
+  }
+}
+
+/* Bit fields spread over three registers, interleaved so that each register's fields are not adjacent. */
+#define READ_FIELD(FIELD) {FIELD, FIELD##_SUBADDR, FIELD##_MASK, FIELD##_OFFSET}
+static const struct
+{
+  uint16_t registerinfo;
+  uint8_t command_code;
+  uint16_t mask;
+  uint8_t offset;
+} read_fields_layout[] =
+{
+  READ_FIELD(LTC4162_SUSPEND_CHARGER),
+  READ_FIELD(LTC4162_EN_SLA_TEMP_COMP),
+  READ_FIELD(LTC4162_RUN_BSR),
+  READ_FIELD(LTC4162_EN_CHG),
+  READ_FIELD(LTC4162_TELEMETRY_SPEED),
+  READ_FIELD(LTC4162_FORCE_TELEMETRY_ON),
+  READ_FIELD(LTC4162_MPPT_EN),
+  READ_FIELD(LTC4162_EQUALIZE_REQ)
+};
+#define READ_FIELDS (sizeof(read_fields_layout) / sizeof(read_fields_layout[0]))
+
+/* LTC4162_read_fields reads each distinct register once and hands every field its own right shifted value. */
+static void test_read_fields()
+{
+  static const uint16_t patterns[] = {0x0000, 0xFFFF, 0x5A5A, 0xA5A5};
+  uint16_t registerinfo[READ_FIELDS], data[READ_FIELDS];
+  uint8_t command_codes[READ_FIELDS];
+  unsigned distinct = 0;
+  for (unsigned i = 0; i < READ_FIELDS; i++)
+  {
+    registerinfo[i] = read_fields_layout[i].registerinfo;
+    unsigned j;
+    for (j = 0; j < distinct && command_codes[j] != read_fields_layout[i].command_code; j++);
+    if (j == distinct) command_codes[distinct++] = read_fields_layout[i].command_code;
+  }
+  CHECK_EQUAL(distinct, 3);
+  for (unsigned p = 0; p < sizeof(patterns) / sizeof(patterns[0]); p++)
+  {
+    LTC4162_sim sim;
+    LTC4162_chip_cfg_t chip = {};
+    sim.attach(&chip);
+    for (unsigned j = 0; j < distinct; j++)
+      sim.set(command_codes[j], (uint16_t)(patterns[p] ^ (j & 1 ? 0xFFFF : 0)));   // Neighbouring registers differ
+    memset(data, 0xEE, sizeof(data));
+    uint32_t reads = sim.reads;
+    CHECK_EQUAL(LTC4162_read_fields(&chip, registerinfo, data, READ_FIELDS), 0);
+    CHECK_EQUAL(sim.reads - reads, distinct);
+    for (unsigned i = 0; i < READ_FIELDS; i++)
+    {
+      uint16_t expected = (uint16_t)((sim.get(read_fields_layout[i].command_code) & read_fields_layout[i].mask) >>
+                                     read_fields_layout[i].offset);
+      CHECK_EQUAL(data[i], expected);
+      uint16_t single;
+      CHECK_EQUAL(LTC4162_read_register(&chip, registerinfo[i], &single), 0);
+      CHECK_EQUAL(data[i], single);
+    }
+  }
+}
+
+/* The compile-time field types encode the same registers and bit fields as the C macros. */
+static_assert(LTC4162::TELEMETRY_SPEED::registerinfo == LTC4162_TELEMETRY_SPEED, "Bit field encoding differs from C");
+static_assert(LTC4162::TELEMETRY_SPEED::mask == LTC4162_TELEMETRY_SPEED_MASK, "Bit field mask differs from C");
+static_assert(LTC4162::VBAT_LO_ALERT_LIMIT_REG::registerinfo == LTC4162_VBAT_LO_ALERT_LIMIT_REG, "Register encoding differs from C");
+static_assert(LTC4162::VBAT_LO_ALERT_LIMIT_REG::is_word && !LTC4162::TELEMETRY_SPEED::is_word, "Word dispatch differs from C");
+
+/* LTC4162::read and LTC4162::write reach the same bits through the simulator as the C API, for a bit field and for a
+ * whole word register, and leave the rest of the register alone. */
+static void test_fields_hpp()
+{
+  LTC4162_sim sim;
+  LTC4162_chip_cfg_t chip = {};
+  uint16_t data, c_data;
+  sim.attach(&chip);
+
+  sim.set(LTC4162_CONFIG_BITS_REG_SUBADDR, LTC4162_MPPT_EN_MASK | LTC4162_SUSPEND_CHARGER_MASK);
+  CHECK_EQUAL((LTC4162::write<LTC4162::TELEMETRY_SPEED, LTC4162_TELEMETRY_SPEED_ENUM_TEL_HIGH_SPEED>(&chip)), 0);
+  CHECK_EQUAL(sim.get(LTC4162_CONFIG_BITS_REG_SUBADDR),
+              LTC4162_MPPT_EN_MASK | LTC4162_SUSPEND_CHARGER_MASK | LTC4162_TELEMETRY_SPEED_MASK);
+  CHECK_EQUAL(LTC4162::read<LTC4162::TELEMETRY_SPEED>(&chip, &data), 0);
+  CHECK_EQUAL(LTC4162_read_register(&chip, LTC4162_TELEMETRY_SPEED, &c_data), 0);
+  CHECK_EQUAL(data, LTC4162_TELEMETRY_SPEED_ENUM_TEL_HIGH_SPEED);
+  CHECK_EQUAL(data, c_data);
+  CHECK_EQUAL(LTC4162::write<LTC4162::TELEMETRY_SPEED>(&chip, LTC4162_TELEMETRY_SPEED_ENUM_TEL_LOW_SPEED), 0);
+  CHECK_EQUAL(sim.get(LTC4162_CONFIG_BITS_REG_SUBADDR), LTC4162_MPPT_EN_MASK | LTC4162_SUSPEND_CHARGER_MASK);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_TELEMETRY_SPEED, LTC4162_TELEMETRY_SPEED_ENUM_TEL_HIGH_SPEED), 0);
+  CHECK_EQUAL(LTC4162::read<LTC4162::TELEMETRY_SPEED>(&chip, &data), 0);
+  CHECK_EQUAL(data, LTC4162_TELEMETRY_SPEED_ENUM_TEL_HIGH_SPEED);
+
+  CHECK_EQUAL((LTC4162::write<LTC4162::VBAT_LO_ALERT_LIMIT_REG, 0xBEEF>(&chip)), 0);
+  CHECK_EQUAL(sim.get(LTC4162_VBAT_LO_ALERT_LIMIT_REG_SUBADDR), 0xBEEF);
+  CHECK_EQUAL(LTC4162::read<LTC4162::VBAT_LO_ALERT_LIMIT_REG>(&chip, &data), 0);
+  CHECK_EQUAL(LTC4162_read_register(&chip, LTC4162_VBAT_LO_ALERT_LIMIT_REG, &c_data), 0);
+  CHECK_EQUAL(data, 0xBEEF);
+  CHECK_EQUAL(data, c_data);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_VBAT_LO_ALERT_LIMIT_REG, 0x1234), 0);
+  CHECK_EQUAL(LTC4162::read<LTC4162::VBAT_LO_ALERT_LIMIT_REG>(&chip, &data), 0);
+  CHECK_EQUAL(data, 0x1234);
+  CHECK_EQUAL(LTC4162::write<LTC4162::VBAT_LO_ALERT_LIMIT_REG>(&chip, 0xCAFE), 0);
+  CHECK_EQUAL(sim.get(LTC4162_VBAT_LO_ALERT_LIMIT_REG_SUBADDR), 0xCAFE);
+
+  chip.read_register = failing_read_register;
+  failing_command_code = LTC4162_VBAT_LO_ALERT_LIMIT_REG_SUBADDR;
+  CHECK_EQUAL(LTC4162::read<LTC4162::VBAT_LO_ALERT_LIMIT_REG>(&chip, &data), LTC4162_sim::NACK);
+}
+
+/* A snapshot whose codes and status bits identify it by n. */
+static LTC4162_telemetry_t history_snapshot(unsigned n, uint32_t timestamp)
+{
+  LTC4162_telemetry_t telemetry = {};
+  telemetry.timestamp = timestamp;
+  telemetry.vbat = (uint16_t)n;
+  telemetry.ibat = (uint16_t)(0 - n);   // Discharging
+  telemetry.charger_state = (uint16_t)(1 << (n % 13));
+  telemetry.charge_status = (uint16_t)(n % 32);
+  telemetry.system_status = (uint16_t)(n * 7 | 0xFE00);   // Bits the history drops
+  return telemetry;
+}
+
+/* The history ring keeps the newest samples oldest first through wraparound, tracks the oldest time stamp as samples
+   are overwritten, saturates long gaps and reconstructs each sample's time stamp, down to sizes 1 and 0. */
+static void test_history()
+{
+  LTC4162_history_sample_t samples[5];
+  LTC4162_history_t history;
+  LTC4162_history_iter_t iter;
+  uint32_t timestamps[13];
+  CHECK_EQUAL(sizeof(LTC4162_history_sample_t), 20);
+
+  LTC4162_history_init(&history, samples, 5);
+  LTC4162_history_iter(&history, &iter);
+  CHECK(LTC4162_history_next(&iter) == NULL);
+  for (unsigned n = 0; n < 13; n++)
+  {
+    timestamps[n] = 1000 + 37 * n * n;
+    LTC4162_telemetry_t telemetry = history_snapshot(n, timestamps[n]);
+    LTC4162_history_append(&history, &telemetry);
+    unsigned count = std::min(n + 1, 5u), oldest = n + 1 - count;
+    CHECK_EQUAL(history.count, count);
+    CHECK_EQUAL(history.appended, n + 1);
+    CHECK_EQUAL(history.first_ms, timestamps[oldest]);
+    CHECK_EQUAL(history.last_ms, timestamps[n]);
+    LTC4162_history_iter(&history, &iter);
+    for (unsigned k = oldest; k <= n; k++)
+    {
+      const LTC4162_history_sample_t *sample = LTC4162_history_next(&iter);
+      CHECK(sample != NULL && sample >= samples && sample < samples + 5);
+      if (sample == NULL) break;
+      CHECK_EQUAL(sample->vbat, (int16_t)k);
+      CHECK_EQUAL(sample->ibat, -(int16_t)k);
+      CHECK_EQUAL(sample->charger_state, 1 << (k % 13));
+      CHECK_EQUAL(LTC4162_HISTORY_CHARGE_STATUS(sample), k % 32);
+      CHECK_EQUAL(LTC4162_HISTORY_SYSTEM_STATUS(sample), k * 7 & LTC4162_HISTORY_SYSTEM_STATUS_MASK);
+      CHECK_EQUAL(iter.time_ms, timestamps[k]);
+    }
+    CHECK(LTC4162_history_next(&iter) == NULL);
+  }
+
+  static const uint32_t gaps[] = {0, 65534, 65535, 65536, 200000};
+  static const uint16_t deltas[] = {0, 65534, LTC4162_HISTORY_DELTA_MAX, LTC4162_HISTORY_DELTA_MAX, LTC4162_HISTORY_DELTA_MAX};
+  uint32_t timestamp = 5000000;   // The first sample's gap is dropped however long it was
+  LTC4162_history_init(&history, samples, 5);
+  for (unsigned n = 0; n < 5; n++)
+  {
+    timestamp += gaps[n];
+    LTC4162_telemetry_t telemetry = history_snapshot(n, timestamp);
+    LTC4162_history_append(&history, &telemetry);
+  }
+  LTC4162_history_iter(&history, &iter);
+  uint32_t time_ms = history.first_ms;
+  for (unsigned n = 0; n < 5; n++)
+  {
+    const LTC4162_history_sample_t *sample = LTC4162_history_next(&iter);
+    CHECK(sample != NULL);
+    if (sample == NULL) break;
+    CHECK_EQUAL(sample->delta_ms, deltas[n]);
+    time_ms += deltas[n];
+    CHECK_EQUAL(iter.time_ms, time_ms);
+  }
+  CHECK_EQUAL(history.first_ms, 5000000);
+  CHECK_EQUAL(history.last_ms, timestamp);
+
+  LTC4162_history_init(&history, samples, 1);
+  for (unsigned n = 0; n < 3; n++)
+  {
+    LTC4162_telemetry_t telemetry = history_snapshot(n, 100 + 150 * n);
+    LTC4162_history_append(&history, &telemetry);
+  }
+  CHECK_EQUAL(history.count, 1);
+  CHECK_EQUAL(history.appended, 3);
+  CHECK_EQUAL(history.first_ms, 400);
+  CHECK_EQUAL(history.last_ms, 400);
+  LTC4162_history_iter(&history, &iter);
+  const LTC4162_history_sample_t *only = LTC4162_history_next(&iter);
+  CHECK(only == &samples[0]);
+  CHECK_EQUAL(samples[0].vbat, 2);
+  CHECK_EQUAL(iter.time_ms, 400);
+  CHECK(LTC4162_history_next(&iter) == NULL);
+
+  LTC4162_history_init(&history, NULL, 0);
+  LTC4162_telemetry_t telemetry = history_snapshot(1, 100);
+  LTC4162_history_append(&history, &telemetry);
+  CHECK_EQUAL(history.count, 0);
+  CHECK_EQUAL(history.appended, 0);
+  LTC4162_history_iter(&history, &iter);
+  CHECK(LTC4162_history_next(&iter) == NULL);
+}
+
+/* A corrupted PEC byte fails a read without harm to the next, and a write with a bad PEC byte changes nothing. */
+static void test_sim_pec()
+{
+  LTC4162_sim sim;
+  LTC4162_chip_cfg_t chip = {};
+  uint16_t data = 0;
+  sim.attach(&chip);
+
+  sim.set(LTC4162_VBAT_REG_SUBADDR, 0x0BAD);
+  sim.corrupt_pec(1);
+  CHECK_EQUAL(LTC4162_read_register(&chip, LTC4162_VBAT, &data), LTC4162_sim::PEC_ERROR);
+  CHECK_EQUAL(LTC4162_read_register(&chip, LTC4162_VBAT, &data), 0);
+  CHECK_EQUAL(data, 0x0BAD);
+
+  CHECK_EQUAL(sim.write_word(LTC4162_ADDR_68, LTC4162_IIN_LIMIT_TARGET_REG_SUBADDR, 0x0005, pec_write_word(LTC4162_ADDR_68, LTC4162_IIN_LIMIT_TARGET_REG_SUBADDR, 0x0005) ^ 0x80), LTC4162_sim::PEC_ERROR);
+  CHECK_EQUAL(sim.get(LTC4162_IIN_LIMIT_TARGET_REG_SUBADDR), sim.get(LTC4162_IIN_LIMIT_TARGET_REG_SUBADDR) & LTC4162_IIN_LIMIT_TARGET_MASK);
+  data = sim.get(LTC4162_IIN_LIMIT_TARGET_REG_SUBADDR);
+  CHECK_EQUAL(sim.write_word(LTC4162_ADDR_68, LTC4162_IIN_LIMIT_TARGET_REG_SUBADDR, data ^ 1, pec_write_word(LTC4162_ADDR_68, LTC4162_IIN_LIMIT_TARGET_REG_SUBADDR, data ^ 1) ^ 0x80), LTC4162_sim::PEC_ERROR);
+  CHECK_EQUAL(sim.get(LTC4162_IIN_LIMIT_TARGET_REG_SUBADDR), data);          // Rejected, unchanged
+  CHECK_EQUAL(sim.pec_errors, 2);
+  CHECK_EQUAL(sim.write_word(LTC4162_ADDR_68, LTC4162_IIN_LIMIT_TARGET_REG_SUBADDR, data ^ 1, pec_write_word(LTC4162_ADDR_68, LTC4162_IIN_LIMIT_TARGET_REG_SUBADDR, data ^ 1)), 0);
+  CHECK_EQUAL(sim.get(LTC4162_IIN_LIMIT_TARGET_REG_SUBADDR), data ^ 1);
+}
+
+/* Completions seen by record_completion, in the order they arrived. */
+struct completion_log
+{
+  unsigned count;
+  int failure[8];
+  uint16_t data[8];
+  void *context[8];
+  uint8_t pending[8];        // LTC4162_queue_pending() seen inside the callback
+  LTC4162_queue_t *queue;
+};
+static completion_log completions;
+
+static void record_completion(int failure, uint16_t data, void *context)
+{
+  unsigned n = completions.count++;
+  if (n >= 8) return;
+  completions.failure[n] = failure;
+  completions.data[n] = data;
+  completions.context[n] = context;
+  completions.pending[n] = LTC4162_queue_pending(completions.queue);
+}
+
+/* Resubmits a read from inside its own callback, which needs the completed slot to be free already. */
+static void resubmit_completion(int failure, uint16_t data, void *context)
+{
+  record_completion(failure, data, context);
+  CHECK_EQUAL(LTC4162_queue_read(completions.queue, LTC4162_VBAT, record_completion, NULL), 0);
+}
+
+/* A bit field write through the cache is one bus write instead of a read and a write, except where a self-clearing
+ * command bit or a reset leaves the cached copy in doubt. */
+static void test_cache()
+{
+  LTC4162_sim sim;
+  LTC4162_cache_t cache = {};
+  LTC4162_chip_cfg_t plain = {}, chip = {};
+  uint32_t bus_reads = 0, bus_writes = 0;
+  chip.cache = &cache;
+  sim.attach(&plain);
+  sim.attach(&chip);
+
+  CHECK_EQUAL(LTC4162_write_register(&plain, LTC4162_SUSPEND_CHARGER, 1), 0);
+  CHECK_BUS(sim, 1, 1);                                                           // No cache: read, modify, write
+  CHECK_EQUAL(LTC4162_write_register(&plain, LTC4162_SUSPEND_CHARGER, 0), 0);
+  CHECK_BUS(sim, 1, 1);
+
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_SUSPEND_CHARGER, 1), 0);
+  CHECK_BUS(sim, 1, 1);                                                           // The first write fills the entry
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_FORCE_TELEMETRY_ON, 1), 0);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_MPPT_EN, 1), 0);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_SUSPEND_CHARGER, 0), 0);
+  CHECK_BUS(sim, 0, 3);                                                           // then each costs one write
+  CHECK_EQUAL(sim.get(LTC4162_CONFIG_BITS_REG_SUBADDR) & (LTC4162_SUSPEND_CHARGER_MASK | LTC4162_FORCE_TELEMETRY_ON_MASK | LTC4162_MPPT_EN_MASK),
+              LTC4162_FORCE_TELEMETRY_ON_MASK | LTC4162_MPPT_EN_MASK);
+
+  /* RUN_BSR clears itself when the measurement is done, so a cached copy with it set is read again. */
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_RUN_BSR, 1), 0);
+  CHECK_BUS(sim, 0, 1);
+  sim.complete_commands();
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_SUSPEND_CHARGER, 1), 0);
+  CHECK_BUS(sim, 1, 1);
+  CHECK_EQUAL(sim.get(LTC4162_CONFIG_BITS_REG_SUBADDR) & LTC4162_RUN_BSR_MASK, 0);   // Not set again from the stale copy
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_SUSPEND_CHARGER, 0), 0);
+  CHECK_BUS(sim, 0, 1);                                                           // Trusted again once read
+
+  /* A reset leaves the cache holding what the LTC4162 has lost. Once invalidated the next write reads first, and
+   * nothing stale is merged back. */
+  sim.power_on_reset();
+  uint16_t config_default = sim.get(LTC4162_CONFIG_BITS_REG_SUBADDR), uvcl_default = sim.get(LTC4162_INPUT_UNDERVOLTAGE_SETTING_REG_SUBADDR);
+  LTC4162_cache_invalidate(&chip);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_SUSPEND_CHARGER, 1), 0);
+  CHECK_BUS(sim, 1, 1);
+  CHECK_EQUAL(sim.get(LTC4162_CONFIG_BITS_REG_SUBADDR), config_default | LTC4162_SUSPEND_CHARGER_MASK);
+
+  /* A resync reads every cached register once, after which bit field writes in any of them are one write each. */
+  sim.power_on_reset();
+  CHECK_EQUAL(LTC4162_cache_resync(&chip), 0);
+  CHECK_BUS(sim, (uint32_t)__builtin_popcountll(cache.valid), 0);
+  CHECK(cache.valid != 0);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_SUSPEND_CHARGER, 1), 0);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_INPUT_UNDERVOLTAGE_SETTING, 0x80), 0);
+  CHECK_BUS(sim, 0, 2);
+  CHECK_EQUAL(sim.get(LTC4162_CONFIG_BITS_REG_SUBADDR), config_default | LTC4162_SUSPEND_CHARGER_MASK);
+  CHECK_EQUAL(sim.get(LTC4162_INPUT_UNDERVOLTAGE_SETTING_REG_SUBADDR),
+              (uvcl_default & ~LTC4162_INPUT_UNDERVOLTAGE_SETTING_MASK) | (0x80 << LTC4162_INPUT_UNDERVOLTAGE_SETTING_OFFSET));
+
+  /* limits_task() rewrites the undervoltage setting and the thermal regulation temperatures every run. A value the
+   * cache shows the LTC4162 already holds is counted and skipped, a changed one still goes out. */
+  uint16_t start = (uint16_t)LTC4162_DIE_TEMP_FORMAT_R2I(109), end = (uint16_t)LTC4162_DIE_TEMP_FORMAT_R2I(111);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_THERMAL_REG_START_TEMP, start), 0);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_THERMAL_REG_END_TEMP, end), 0);
+  bus_reads = sim.reads;
+  bus_writes = sim.writes;
+  uint32_t suppressed = cache.suppressed_writes;
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_INPUT_UNDERVOLTAGE_SETTING, 0x80), 0);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_THERMAL_REG_START_TEMP, start), 0);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_THERMAL_REG_END_TEMP, end), 0);
+  CHECK_BUS(sim, 0, 0);
+  CHECK_EQUAL(cache.suppressed_writes - suppressed, 3);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_INPUT_UNDERVOLTAGE_SETTING, 0x81), 0);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_THERMAL_REG_END_TEMP, end + 1), 0);
+  CHECK_BUS(sim, 0, 2);
+  CHECK_EQUAL(cache.suppressed_writes - suppressed, 3);
+  CHECK_EQUAL(sim.get(LTC4162_INPUT_UNDERVOLTAGE_SETTING_REG_SUBADDR) & LTC4162_INPUT_UNDERVOLTAGE_SETTING_MASK,
+              0x81 << LTC4162_INPUT_UNDERVOLTAGE_SETTING_OFFSET);
+  CHECK_EQUAL(sim.get(LTC4162_THERMAL_REG_END_TEMP_REG_SUBADDR), (uint16_t)(end + 1));
+
+  /* After an invalidate the same values go out again, and a write setting a command bit is never skipped. */
+  sim.power_on_reset();
+  LTC4162_cache_invalidate(&chip);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_INPUT_UNDERVOLTAGE_SETTING, 0x81), 0);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_THERMAL_REG_END_TEMP, end + 1), 0);
+  CHECK_BUS(sim, 1, 2);
+  CHECK_EQUAL(sim.get(LTC4162_THERMAL_REG_END_TEMP_REG_SUBADDR), (uint16_t)(end + 1));
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_RUN_BSR, 1), 0);
+  CHECK_EQUAL(LTC4162_write_register(&chip, LTC4162_RUN_BSR, 1), 0);
+  CHECK_BUS(sim, 2, 2);
+  CHECK_EQUAL(cache.suppressed_writes - suppressed, 3);
+}
+
+/* Submission order, callbacks, the reject policy when full and slot retirement before the callback. */
+static void test_queue()
+{
+  LTC4162_sim sim;
+  LTC4162_chip_cfg_t chip = {};
+  LTC4162_transaction_t slots[3];
+  LTC4162_queue_t queue;
+  int tag[4];
+  sim.attach(&chip);
+  LTC4162_queue_init(&queue, &chip, slots, 3);
+  completions = completion_log();
+  completions.queue = &queue;
+
+  sim.set(LTC4162_VBAT_REG_SUBADDR, 0x1111);
+  CHECK_EQUAL(LTC4162_queue_write(&queue, LTC4162_SUSPEND_CHARGER, 1, record_completion, &tag[0]), 0);
+  CHECK_EQUAL(LTC4162_queue_read(&queue, LTC4162_SUSPEND_CHARGER, record_completion, &tag[1]), 0);
+  CHECK_EQUAL(LTC4162_queue_read(&queue, LTC4162_VBAT, record_completion, &tag[2]), 0);
+  CHECK(LTC4162_queue_read(&queue, LTC4162_VBAT, record_completion, &tag[3]) != 0);   // Full: refused, not overwritten
+  CHECK_EQUAL(queue.rejected, 1);
+  CHECK_EQUAL(LTC4162_queue_pending(&queue), 3);
+  CHECK_EQUAL(sim.writes, 0);                                                     // Nothing on the bus until serviced
+
+  CHECK_EQUAL(LTC4162_queue_service(&queue, 2), 2);                               // Bounded by max_transactions
+  CHECK_EQUAL(LTC4162_queue_pending(&queue), 1);
+  CHECK_EQUAL(LTC4162_queue_service(&queue, 8), 1);
+  CHECK_EQUAL(LTC4162_queue_service(&queue, 8), 0);
+  CHECK_EQUAL(completions.count, 3);
+  CHECK(completions.context[0] == &tag[0] && completions.context[1] == &tag[1] && completions.context[2] == &tag[2]);
+  CHECK_EQUAL(completions.data[0], 1);                                            // Write: the data written
+  CHECK_EQUAL(completions.data[1], 1);                                            // Read after the write sees it
+  CHECK_EQUAL(completions.data[2], 0x1111);
+  CHECK_EQUAL(completions.pending[0], 2);                                         // Slot retired before the callback
+  CHECK_EQUAL(completions.pending[2], 0);
+  CHECK(!completions.failure[0] && !completions.failure[1] && !completions.failure[2]);
+
+  /* A callback may refill the slot it just left, even when every other slot is in use. */
+  completions = completion_log();
+  completions.queue = &queue;
+  CHECK_EQUAL(LTC4162_queue_read(&queue, LTC4162_VBAT, resubmit_completion, NULL), 0);
+  CHECK_EQUAL(LTC4162_queue_read(&queue, LTC4162_VBAT, record_completion, NULL), 0);
+  CHECK_EQUAL(LTC4162_queue_read(&queue, LTC4162_VBAT, record_completion, NULL), 0);
+  CHECK_EQUAL(LTC4162_queue_service(&queue, 1), 1);
+  CHECK_EQUAL(queue.rejected, 1);
+  CHECK_EQUAL(LTC4162_queue_pending(&queue), 3);
+  CHECK_EQUAL(LTC4162_queue_service(&queue, 8), 3);
+  CHECK_EQUAL(completions.count, 4);
+
+  /* Bus failures and read back mismatches reach the callback. */
+  completions = completion_log();
+  completions.queue = &queue;
+  sim.corrupt_pec(1);
+  CHECK_EQUAL(LTC4162_queue_read(&queue, LTC4162_VBAT, record_completion, NULL), 0);
+  CHECK_EQUAL(LTC4162_queue_write_policy(&queue, LTC4162_VBAT, 0x2222, LTC4162_WRITE_VERIFY_READBACK, record_completion, NULL), 0);
+  CHECK_EQUAL(LTC4162_queue_service(&queue, 8), 2);
+  CHECK_EQUAL(completions.failure[0], LTC4162_sim::PEC_ERROR);
+  CHECK_EQUAL(completions.failure[1], LTC4162_VERIFY_FAILED);
+  CHECK_EQUAL(sim.get(LTC4162_VBAT_REG_SUBADDR), 0x1111);
+}
+
+/* Refusal and the dropped count when full, and slot indexing as the 8 bit head and tail wrap. */
+static void test_event_queue()
+{
+  LTC4162_event_queue_t queue;
+  LTC4162_event_t event;
+  LTC4162_event_init(&queue);
+  CHECK_EQUAL(LTC4162_event_take(&queue, &event), 0);
+
+  for (unsigned i = 0; i < LTC4162_EVENT_QUEUE_SIZE; i++)
+    CHECK_EQUAL(LTC4162_event_post(&queue, 1, (uint16_t)i, 100 + i), 0);
+  CHECK(LTC4162_event_post(&queue, 2, 0xFFFF, 0) != 0);                          // Full: refused, not overwritten
+  CHECK(LTC4162_event_post(&queue, 2, 0xFFFF, 0) != 0);
+  CHECK_EQUAL(queue.dropped, 2);
+  for (unsigned i = 0; i < LTC4162_EVENT_QUEUE_SIZE; i++)
+  {
+    CHECK_EQUAL(LTC4162_event_take(&queue, &event), 1);
+    CHECK_EQUAL(event.data, i);
+    CHECK_EQUAL(event.stamp, 100 + i);
+  }
+  CHECK_EQUAL(LTC4162_event_take(&queue, &event), 0);
+
+  /* Run the indexes around 256 several times at every fill level from one to full. */
+  uint16_t posted = 0, taken = 0;
+  for (unsigned round = 0; round < 64; round++)
+  {
+    unsigned fill = round % LTC4162_EVENT_QUEUE_SIZE + 1;
+    for (unsigned i = 0; i < fill; i++)
+      CHECK_EQUAL(LTC4162_event_post(&queue, (uint8_t)round, posted++, round), 0);
+    bool in_order = true;
+    for (unsigned i = 0; i < fill; i++)
+      in_order &= LTC4162_event_take(&queue, &event) == 1 && event.data == taken++ && event.type == round;
+    CHECK(in_order);
+    CHECK_EQUAL(LTC4162_event_take(&queue, &event), 0);
+  }
+  CHECK(posted > 512);
+  CHECK_EQUAL(queue.dropped, 2);
+}
+
+/* One producer and one consumer thread, as the SMBALERT interrupt and the alert task: every event arrives once, in
+ * order and whole, with the producer retrying whenever it finds the queue full. */
+static void test_event_stress()
+{
+  static LTC4162_event_queue_t queue;
+  const uint32_t count = 200000;
+  uint32_t refused = 0;
+  LTC4162_event_init(&queue);
+  std::thread producer([&]()
+  {
+    for (uint32_t i = 0; i < count; i++)
+      while (LTC4162_event_post(&queue, (uint8_t)i, (uint16_t)(i * 7), i) != 0)
+      {
+        refused++;
+        std::this_thread::yield();
+      }
+  });
+  uint32_t received = 0, mismatches = 0;
+  LTC4162_event_t event;
+  while (received < count)
+  {
+    if (!LTC4162_event_take(&queue, &event))
+    {
+      std::this_thread::yield();
+      continue;
+    }
+    mismatches += event.stamp != received || event.type != (uint8_t)received || event.data != (uint16_t)(received * 7);
+    received++;
+  }
+  producer.join();
+  CHECK_EQUAL(mismatches, 0);
+  CHECK_EQUAL(LTC4162_event_take(&queue, &event), 0);
+  CHECK_EQUAL(queue.dropped, (uint16_t)refused);                                // Each refusal counted once
+}
+
+/* Virtual clocks for the scheduler: a task run advances them by the task's cost in milliseconds at 80 MHz. */
+static uint32_t virtual_ms, virtual_cycles;
+static uint32_t virtual_clock_ms(void) { return virtual_ms; }
+static uint32_t virtual_clock_cycles(void) { return virtual_cycles; }
+static void virtual_work(void *context)
+{
+  uint32_t cost_ms = *(const uint32_t *)context;
+  virtual_ms += cost_ms;
+  virtual_cycles += cost_ms * 80000;
+}
+#define VIRTUAL_TASK(name, cost, period_ms, deadline_ms, budget_ms) {name, virtual_work, &costs_ms[cost], period_ms, deadline_ms, budget_ms * 80000, 0, 0, 0, 0, 0, 0, 0, 0}
+
+/* Late starts, skipped releases, overruns and wakes, each counted where LTC4162-SAD_sched.h says. */
+static void test_sched_accounting()
+{
+  static uint32_t costs_ms[] = {1, 3, 0};
+  static LTC4162_task_t tasks[] =
+  {
+    VIRTUAL_TASK("periodic", 0, 100, 10, 2),
+    VIRTUAL_TASK("heavy", 1, 1000, 1000, 2),
+    VIRTUAL_TASK("woken", 2, 0, 5, 1),
+  };
+  LTC4162_sched_t sched;
+  virtual_ms = virtual_cycles = 0;
+  LTC4162_sched_init(&sched, tasks, 3, virtual_clock_ms, virtual_clock_cycles);
+
+  CHECK_EQUAL(LTC4162_sched_run(&sched), 2);             // Both periodic tasks are released at init
+  CHECK_EQUAL(tasks[1].overruns, 1);                     // 3 ms against a 2 ms budget
+  CHECK_EQUAL(tasks[1].max_lateness_ms, 1);              // Started after the first task's 1 ms
+  CHECK_EQUAL(LTC4162_sched_idle_ms(&sched), 96);
+
+  virtual_ms = 105;
+  CHECK_EQUAL(LTC4162_sched_run(&sched), 1);
+  CHECK_EQUAL(tasks[0].misses, 0);                       // 5 ms late, inside the 10 ms deadline
+  virtual_ms = 215;
+  LTC4162_sched_run(&sched);
+  CHECK_EQUAL(tasks[0].misses, 1);                       // 15 ms late
+  virtual_ms = 650;
+  LTC4162_sched_run(&sched);
+  CHECK_EQUAL(tasks[0].misses, 5);                       // 350 ms late, and the releases at 400, 500 and 600 skipped
+  CHECK_EQUAL(tasks[0].runs, 4);
+  CHECK_EQUAL(tasks[0].max_lateness_ms, 350);
+  CHECK_EQUAL(tasks[0].release_ms, 700);
+  CHECK_EQUAL(tasks[0].overruns, 0);
+
+  LTC4162_sched_wake(&sched, &tasks[2]);
+  CHECK_EQUAL(LTC4162_sched_idle_ms(&sched), 0);
+  virtual_ms = 660;
+  CHECK_EQUAL(LTC4162_sched_run(&sched), 1);
+  CHECK_EQUAL(tasks[2].runs, 1);
+  CHECK_EQUAL(tasks[2].misses, 1);                       // 9 ms after the wake at 651, 5 ms deadline
+  CHECK_EQUAL(LTC4162_sched_run(&sched), 0);             // The wake is used up
+  CHECK_EQUAL(LTC4162_sched_idle_ms(&sched), 40);        // The task woken only on demand does not count
+
+  LTC4162_sched_reset_stats(&sched);
+  CHECK(!tasks[0].runs && !tasks[0].misses && !tasks[1].overruns && !tasks[0].max_lateness_ms);
+}
+
+/* Ten minutes of the sketch's task table, with the web page served every two seconds. The 150 ms page blocks the
+   20 ms tasks and the LEDs, but the charger's own tasks must neither miss nor overrun. */
+#define SCHEDULE_MS (10 * 60 * 1000)
+static void test_sched_sketch()
+{
+  static uint32_t costs_ms[] = {1, 8, 0, 0, 1, 0, 0, 150};
+  static LTC4162_task_t tasks[] =
+  {
+    VIRTUAL_TASK("power", 0, 100, 100, 2),
+    VIRTUAL_TASK("telemetry", 1, 1000, 500, 10),
+    VIRTUAL_TASK("history", 2, 10000, 1000, 1),
+    VIRTUAL_TASK("leds", 3, 100, 50, 1),
+    VIRTUAL_TASK("limits", 4, 5000, 1000, 2),
+    VIRTUAL_TASK("queue", 5, 20, 100, 5),
+    VIRTUAL_TASK("http", 6, 20, 100, 200),
+    VIRTUAL_TASK("page", 7, 2000, 2000, 200),
+  };
+  const uint8_t count = sizeof(tasks) / sizeof(tasks[0]);
+  LTC4162_sched_t sched;
+  virtual_ms = virtual_cycles = 0;
+  LTC4162_sched_init(&sched, tasks, count, virtual_clock_ms, virtual_clock_cycles);
+  while (virtual_ms < SCHEDULE_MS)
+  {
+    uint32_t idle;
+    LTC4162_sched_run(&sched);
+    idle = LTC4162_sched_idle_ms(&sched);
+    virtual_ms += idle < SCHEDULE_MS - virtual_ms ? idle : SCHEDULE_MS - virtual_ms;
+  }
+  for (uint8_t t = 0; t < count; t++)
+  {
+    const LTC4162_task_t *task = &tasks[t];
+    bool charger = strcmp(task->name, "leds") && strcmp(task->name, "queue") && strcmp(task->name, "http");
+    CHECK_EQUAL(task->overruns, 0);
+    CHECK(task->runs <= SCHEDULE_MS / task->period_ms);
+    if (!charger) continue;
+    CHECK_EQUAL(task->misses, 0);
+    CHECK_EQUAL(task->runs, SCHEDULE_MS / task->period_ms);
+  }
+}
+
+/* Sets a bit field the LTC4162 itself writes, such as a measurement or status bit, in the simulator. */
+#define SIM_SET_FIELD(sim, FIELD, value) \
+  (sim).set(FIELD##_SUBADDR, (uint16_t)(((sim).get(FIELD##_SUBADDR) & ~FIELD##_MASK) | (((value) << FIELD##_OFFSET) & FIELD##_MASK)))
+
+/* Input sources for the solar detection probe, charging a 12V lead acid battery at up to 2A with 90% efficiency. The
+   charger draws the power it needs at the highest input voltage that can supply it, or collapses to the
+   undervoltage setting if none can, or with MPPT runs at the maximum power point. */
+#define SOLAR_VBAT 12.6
+#define SOLAR_CELL_COUNT LTC4162_CELL_COUNT_ENUM_12V_BATTERY
+#define SOLAR_IBAT_MAX 2.0
+#define SOLAR_EFFICIENCY 0.9
+#define SOLAR_STEP_MS 100     // power_task() period
+#define SOLAR_LIMITS_MS 5000  // limits_task() period
+struct solar_source
+{
+  const char *name;
+  double voc;          // Open circuit volts
+  double isc;          // Short circuit amps, panels only
+  double resistance;   // Output ohms, other sources
+  bool expected;       // Should be treated as a solar panel, so run with MPPT
+};
+static const struct solar_source solar_sources[] =
+{
+  {"panel_20w", 21.6, 1.2, 0, true},
+  {"panel_5w", 21.6, 0.3, 0, true},
+  {"wall_adapter_20v", 20.0, 0, 0.05, false},
+  {"long_cable_20v", 20.0, 0, 2.0, true},     // A resistive source, which MPPT is also for
+};
+static double source_amps(const struct solar_source *source, double volts)
+{
+  if (volts >= source->voc) return 0;
+  if (source->resistance > 0) return (source->voc - volts) / source->resistance;
+  return source->isc * (1 - exp((volts - source->voc) / 1.5));   // A 36 cell panel's diode curve
+}
+/* Moves VIN and IBAT to the operating point the input undervoltage and MPPT settings give with the source. */
+static void solar_operate(LTC4162_sim &sim, const struct solar_source *source, bool input_power)
+{
+  double demand = SOLAR_VBAT * SOLAR_IBAT_MAX / SOLAR_EFFICIENCY, volts = source->voc, watts = 0, best = 0, best_volts = 0;
+  double uvcl_volts = LTC4162_VIN_UVCL_U2R(sim.get(LTC4162_INPUT_UNDERVOLTAGE_SETTING_SUBADDR) & LTC4162_INPUT_UNDERVOLTAGE_SETTING_MASK);
+  for (double v = source->voc; v > 0; v -= 0.001)
+    if (v * source_amps(source, v) > best) best = v * source_amps(source, v), best_volts = v;
+  if (sim.get(LTC4162_MPPT_EN_SUBADDR) & LTC4162_MPPT_EN_MASK) uvcl_volts = best_volts;
+  for (double v = source->voc; v >= uvcl_volts; v -= 0.001)
+    if (v * source_amps(source, v) >= demand)
+    {
+      volts = v, watts = demand;
+      break;
+    }
+  if (watts == 0 && uvcl_volts < source->voc)
+    volts = uvcl_volts, watts = uvcl_volts * source_amps(source, uvcl_volts);
+  if (!input_power) volts = 0, watts = 0;
+  SIM_SET_FIELD(sim, LTC4162_VIN_GT_VBAT, input_power ? 1 : 0);
+  SIM_SET_FIELD(sim, LTC4162_VIN, (uint16_t)LTC4162_VIN_FORMAT_R2I(volts));
+  SIM_SET_FIELD(sim, LTC4162_IBAT, (uint16_t)LTC4162_IBAT_FORMAT_R2I(watts * SOLAR_EFFICIENCY / SOLAR_VBAT));
+}
+/* Steps a probe at the power task's period until it finishes, cutting input power from unplug_ms if that is non-zero.
+   Alongside, the sketch's limits task puts the undervoltage setting back to 17V every five seconds, starting
+   limits_phase_ms into the probe, and if gated leaves it alone while the probe runs. Returns the virtual time taken. */
+static uint32_t solar_probe(LTC4162_sim &sim, LTC4162_chip_cfg_t *chip, LTC4162_solar_t *solar, const struct solar_source *source,
+                            uint32_t unplug_ms, uint32_t limits_phase_ms, bool gated)
+{
+  uint32_t now = 0;
+  sim.power_on_reset();
+  SIM_SET_FIELD(sim, LTC4162_CELL_COUNT, SOLAR_CELL_COUNT);
+  SIM_SET_FIELD(sim, LTC4162_VBAT, (uint16_t)LTC4162_VBAT_SLA_FORMAT_R2I(SOLAR_VBAT * 2 / SOLAR_CELL_COUNT));
+  solar_operate(sim, source, true);
+  LTC4162_solar_init(solar, 98);
+  LTC4162_solar_start(solar, chip, now);
+  do
+  {
+    bool input_power = unplug_ms == 0 || now < unplug_ms;
+    now += SOLAR_STEP_MS;
+    solar_operate(sim, source, input_power);
+    LTC4162_solar_step(solar, chip, now, input_power);
+    if (now % SOLAR_LIMITS_MS == limits_phase_ms && (!gated || solar->state == LTC4162_SOLAR_IDLE))
+      LTC4162_write_register(chip, LTC4162_INPUT_UNDERVOLTAGE_SETTING, LTC4162_VIN_UVCL_R2U(17));
+  } while (solar->state != LTC4162_SOLAR_IDLE);
+  return now;
+}
+
+/* Each source classified as expected with the limits task at every phase, left charging with MPPT on for panels and
+   the undervoltage setting 2V above the battery, and a probe cut short by unplugging aborted cleanly. */
+static void test_solar()
+{
+  const size_t sources = sizeof(solar_sources) / sizeof(solar_sources[0]);
+  LTC4162_sim sim;
+  LTC4162_chip_cfg_t chip = {};
+  LTC4162_solar_t solar;
+  unsigned ungated_wrong = 0;
+  sim.attach(&chip);
+  for (size_t n = 0; n < sources; n++)
+  {
+    const struct solar_source *source = &solar_sources[n];
+    for (uint32_t phase = 0; phase < SOLAR_LIMITS_MS; phase += SOLAR_STEP_MS)
+    {
+      uint32_t probe_ms = solar_probe(sim, &chip, &solar, source, 0, phase, true);
+      bool mppt = sim.get(LTC4162_MPPT_EN_SUBADDR) & LTC4162_MPPT_EN_MASK;
+      uint16_t uvcl = sim.get(LTC4162_INPUT_UNDERVOLTAGE_SETTING_SUBADDR) & LTC4162_INPUT_UNDERVOLTAGE_SETTING_MASK;
+      if (solar.solar_panel != source->expected || mppt != source->expected) printf("  %s, limits at %u ms\n", source->name, (unsigned)phase);
+      CHECK_EQUAL(solar.solar_panel, source->expected);
+      CHECK_EQUAL(mppt, source->expected);
+      CHECK_EQUAL(solar.aborts, 0);
+      CHECK(probe_ms <= LTC4162_SOLAR_OPEN_CIRCUIT_MS + LTC4162_SOLAR_BATTERY_DETECT_MS + 2 * LTC4162_SOLAR_CURRENT_MS + 2 * SOLAR_STEP_MS);
+      if (phase == SOLAR_LIMITS_MS - SOLAR_STEP_MS) CHECK_EQUAL(uvcl, LTC4162_VIN_UVCL_FIX2U(solar.vbat_mv + 2000));   // No write after the probe
+      solar_probe(sim, &chip, &solar, source, 0, phase, false);
+      if (solar.solar_panel != source->expected) ungated_wrong++;
+    }
+  }
+  CHECK(ungated_wrong > 0);   // The simulation does see a 17V write landing in the middle of a probe
+
+  solar_probe(sim, &chip, &solar, &solar_sources[0], 1000, 0, true);   // Unplugged during battery detection
+  CHECK_EQUAL(solar.aborts, 1);
+  CHECK(!solar.solar_panel);
+  CHECK_EQUAL(sim.get(LTC4162_MPPT_EN_SUBADDR) & LTC4162_MPPT_EN_MASK, 0);
+  CHECK_EQUAL(sim.get(LTC4162_INPUT_UNDERVOLTAGE_SETTING_SUBADDR) & LTC4162_INPUT_UNDERVOLTAGE_SETTING_MASK, LTC4162_VIN_UVCL_FIX2U(solar.vbat_mv + 2000));
+}
+
+/* Ten minutes of charging, one pass a second as the sketch's window task with a full telemetry pass every ten: VBAT
+   creeps up, the charge current tapers, a system load steps the input current up between full passes, the die and
+   the battery warm and the rest hold still but for a code of noise. After each conversion the limit alerts are raised
+   by comparing each reading with its enabled limits, as the LTC4162 does. */
+#define BATTERY_VBAT 12.6   // A 12V lead acid battery
+#define BATTERY_CELL_COUNT LTC4162_CELL_COUNT_ENUM_12V_BATTERY
+#define WINDOW_PASSES 600
+#define WINDOW_FULL_PASS 10
+static const uint16_t window_hysteresis[LTC4162_WINDOW_CHANNELS] =   // As the sketch
+{
+  LTC4162_VBAT_SLA_FORMAT_R2I(0.010),
+  LTC4162_VIN_FORMAT_R2I(0.100),
+  LTC4162_VOUT_FORMAT_R2I(0.100),
+  LTC4162_IIN_FORMAT_R2I(0.020),
+  LTC4162_IBAT_FORMAT_R2I(0.020),
+  LTC4162_DIE_TEMP_FORMAT_R2I(1) - LTC4162_DIE_TEMP_FORMAT_R2I(0),
+  LTC4162_BSR_FORMAT_SLA_R2U(0.001),
+  LTC4162_NTCS0402E3103FLT_R2I(24) - LTC4162_NTCS0402E3103FLT_R2I(25),
+};
+static const uint8_t window_readings[LTC4162_WINDOW_CHANNELS] =   // In LTC4162_window_channel_t order
+{
+  LTC4162_VBAT_REG_SUBADDR, LTC4162_VIN_REG_SUBADDR, LTC4162_VOUT_REG_SUBADDR, LTC4162_IIN_REG_SUBADDR,
+  LTC4162_IBAT_REG_SUBADDR, LTC4162_DIE_TEMP_REG_SUBADDR, LTC4162_BSR_REG_SUBADDR, LTC4162_THERMISTOR_VOLTAGE_REG_SUBADDR
+};
+static uint16_t LTC4162_telemetry_t::*const window_members[LTC4162_WINDOW_CHANNELS] =
+{
+  &LTC4162_telemetry_t::vbat, &LTC4162_telemetry_t::vin, &LTC4162_telemetry_t::vout, &LTC4162_telemetry_t::iin,
+  &LTC4162_telemetry_t::ibat, &LTC4162_telemetry_t::die_temp, &LTC4162_telemetry_t::bsr, &LTC4162_telemetry_t::thermistor_voltage
+};
+static const struct
+{
+  uint8_t reading;    // Register the limit is compared with
+  int8_t side;        // -1 trips below the limit, 1 above
+} window_model[] =    // VBAT_LO_ALERT_LIMIT_REG (0x01) to THERMISTOR_VOLTAGE_LO_ALERT_LIMIT_REG (0x0C), alert bits 11 down to 0
+{
+  {LTC4162_VBAT_REG_SUBADDR, -1}, {LTC4162_VBAT_REG_SUBADDR, 1}, {LTC4162_VIN_REG_SUBADDR, -1}, {LTC4162_VIN_REG_SUBADDR, 1},
+  {LTC4162_VOUT_REG_SUBADDR, -1}, {LTC4162_VOUT_REG_SUBADDR, 1}, {LTC4162_IIN_REG_SUBADDR, 1}, {LTC4162_IBAT_REG_SUBADDR, -1},
+  {LTC4162_DIE_TEMP_REG_SUBADDR, 1}, {LTC4162_BSR_REG_SUBADDR, 1}, {LTC4162_THERMISTOR_VOLTAGE_REG_SUBADDR, 1}, {LTC4162_THERMISTOR_VOLTAGE_REG_SUBADDR, -1}
+};
+static void window_convert(LTC4162_sim &sim, uint32_t pass)
+{
+  double progress = (double)pass / WINDOW_PASSES;
+  int noise = (int)(pass * 7919u % 3) - 1;
+  sim.set(LTC4162_VBAT_REG_SUBADDR, (uint16_t)(int16_t)(LTC4162_VBAT_SLA_FORMAT_R2I(BATTERY_VBAT * 2 / BATTERY_CELL_COUNT) * (1 + 0.04 * progress)));
+  sim.set(LTC4162_VIN_REG_SUBADDR, (uint16_t)(LTC4162_VIN_FORMAT_R2I(BATTERY_VBAT + 5) + noise));
+  sim.set(LTC4162_VOUT_REG_SUBADDR, (uint16_t)(LTC4162_VOUT_FORMAT_R2I(BATTERY_VBAT + 0.2) + noise));
+  sim.set(LTC4162_IIN_REG_SUBADDR, (uint16_t)LTC4162_IIN_FORMAT_R2I(1.5 - 0.5 * progress + (pass >= WINDOW_PASSES / 2 + WINDOW_FULL_PASS / 2 ? 0.5 : 0)));
+  sim.set(LTC4162_IBAT_REG_SUBADDR, (uint16_t)LTC4162_IBAT_FORMAT_R2I(2 - progress));
+  sim.set(LTC4162_DIE_TEMP_REG_SUBADDR, (uint16_t)LTC4162_DIE_TEMP_FORMAT_R2I(40 + 15 * progress));
+  sim.set(LTC4162_BSR_REG_SUBADDR, LTC4162_BSR_FORMAT_SLA_R2U(0.050));
+  sim.set(LTC4162_THERMISTOR_VOLTAGE_REG_SUBADDR, (uint16_t)LTC4162_NTCS0402E3103FLT_R2I(25 + 3 * progress));
+  for (uint8_t i = 0; i < sizeof(window_model) / sizeof(window_model[0]); i++)
+  {
+    uint16_t alert = 1u << (11 - i);
+    uint16_t code = sim.get(window_model[i].reading), limit = sim.get(LTC4162_VBAT_LO_ALERT_LIMIT_REG_SUBADDR + i);
+    bool is_signed = window_model[i].reading != LTC4162_BSR_REG_SUBADDR;
+    int32_t value = is_signed ? (int16_t)code : code, bound = is_signed ? (int16_t)limit : limit;
+    if ((sim.get(LTC4162_EN_LIMIT_ALERTS_REG_SUBADDR) & alert) && (window_model[i].side < 0 ? value < bound : value > bound))
+      sim.set(LTC4162_LIMIT_ALERTS_REG_SUBADDR, sim.get(LTC4162_LIMIT_ALERTS_REG_SUBADDR) | alert);
+  }
+}
+
+/* Runs the charge with a full telemetry pass every full_pass passes, recording each channel's worst distance from the
+ * true reading and the bus transactions taken. */
+static void window_run(uint32_t full_pass, LTC4162_window_t *window, int32_t max_error[LTC4162_WINDOW_CHANNELS], uint32_t *transactions)
+{
+  LTC4162_sim sim;
+  LTC4162_cache_t cache = {};
+  LTC4162_chip_cfg_t chip = {};
+  LTC4162_telemetry_t snapshot = {};
+  uint32_t before;
+  chip.cache = &cache;
+  sim.attach(&chip);
+  LTC4162_cache_invalidate(&chip);
+  LTC4162_window_init(window, window_hysteresis);
+  *transactions = 0;
+  for (uint8_t c = 0; c < LTC4162_WINDOW_CHANNELS; c++) max_error[c] = 0;
+  for (uint32_t pass = 0; pass < WINDOW_PASSES; pass++)
+  {
+    window_convert(sim, pass);
+    before = sim.reads + sim.writes;
+    if (pass % full_pass == 0)
+    {
+      CHECK_EQUAL(LTC4162_read_telemetry(&chip, &snapshot, pass * 1000), 0);
+      CHECK_EQUAL(LTC4162_window_arm(window, &chip, &snapshot), 0);
+    }
+    else
+      CHECK_EQUAL(LTC4162_window_poll(window, &chip, &snapshot, pass * 1000), 0);
+    *transactions += sim.reads + sim.writes - before;
+    for (uint8_t c = 0; c < LTC4162_WINDOW_CHANNELS; c++)
+    {
+      uint16_t truth = sim.get(window_readings[c]);
+      int32_t error = c == LTC4162_WINDOW_BSR ? (int32_t)(snapshot.*window_members[c]) - truth
+                                              : (int32_t)(int16_t)(snapshot.*window_members[c]) - (int16_t)truth;
+      if (error < 0) error = -error;
+      if (error > max_error[c]) max_error[c] = error;
+    }
+  }
+}
+
+/* At the sketch's full pass rate every channel stays within its hysteresis of the true reading, the load step trips
+ * the input current window, and the bus carries well under half of what reading every channel each pass would. Armed
+ * once and never refreshed, the windows alone still hold every channel but the input current, which falls away from
+ * its high limit unseen: that is what the full pass is for. */
+static void test_window()
+{
+  LTC4162_window_t window;
+  int32_t max_error[LTC4162_WINDOW_CHANNELS];
+  uint32_t transactions, before;
+  LTC4162_sim sim;
+  LTC4162_chip_cfg_t chip = {};
+  LTC4162_telemetry_t telemetry;
+  sim.attach(&chip);
+  before = sim.reads;
+  CHECK_EQUAL(LTC4162_read_telemetry(&chip, &telemetry, 0), 0);
+  uint32_t polling_transactions = (sim.reads - before) * WINDOW_PASSES;
+
+  window_run(WINDOW_FULL_PASS, &window, max_error, &transactions);
+  for (uint8_t c = 0; c < LTC4162_WINDOW_CHANNELS; c++)
+    check(max_error[c] <= window_hysteresis[c], "max_error[c] <= window_hysteresis[c]", __LINE__);
+  CHECK(window.trips >= 1);                                                       // The load step
+  CHECK(window.rereads >= 1);
+  CHECK(transactions * 2 < polling_transactions);
+
+  window_run(WINDOW_PASSES, &window, max_error, &transactions);
+  for (uint8_t c = 0; c < LTC4162_WINDOW_CHANNELS; c++)
+    if (c != LTC4162_WINDOW_IIN) check(max_error[c] <= window_hysteresis[c], "max_error[c] <= window_hysteresis[c]", __LINE__);
+  CHECK(max_error[LTC4162_WINDOW_IIN] > window_hysteresis[LTC4162_WINDOW_IIN]);
+  CHECK(window.trips > 10);
+}
+
+int main()
+{
+  test_pec();
+  test_trace();
+  test_fix();
+  test_fmt();
+  test_ntc();
+  test_bulk();
+  test_sim_registers();
+  test_sim_alerts_and_ship_mode();
+  test_sim_pec();
+  test_read_telemetry();
+  test_history();
+  test_read_fields();
+  test_fields_hpp();
+  test_cache();
+  test_queue();
+  test_event_queue();
+  test_event_stress();
+  test_sched_accounting();
+  test_sched_sketch();
+  test_solar();
+  test_window();
+  printf("LTC4162-S: %u checks, %u failed\n", checks, failures);
+  return failures ? 1 : 0;
+}
+
+#endif /* ARDUINO */
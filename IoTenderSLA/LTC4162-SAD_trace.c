@@ -0,0 +1,174 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-S is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters as well as numerous system status
+alerts. The LTC4162-S can charge from one to four 6V Lead-Acid batteries or one
+to two 12V Lead-Acid batteries with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-S is
+available in an I²C adjustable version as well a fixed voltage version both with
+and without MPPT enabled by default. The LTC4162-S is available in the 28-pin
+4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date$
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-SAD
+ *  @brief LTC4162-SAD offline PEC verification of captured SMBus word transactions.
+ */
+
+#ifndef ARDUINO
+
+#include "LTC4162-SAD_trace.h"
+#include "LTC4162-SAD_pec.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define TRACE_CLMUL
+#include <wmmintrin.h>
+#endif
+
+/* The frame's bytes in bus order, PEC last, as one polynomial with the first bit sent as the highest power.
+ * Branch free, since captures mix reads and writes unpredictably.
+ */
+static inline uint64_t frame_polynomial(const LTC4162_trace_frame_t *frame)
+{
+  uint64_t head = (uint64_t)(frame->address << 1) << 8 | frame->command_code;
+  uint64_t read = (uint64_t)0 - (frame->read != 0);
+  uint64_t tail = (uint64_t)(frame->data & 0xFF) << 16 | (uint64_t)(frame->data >> 8) << 8 | frame->pec;
+  head = (head << 24) ^ (read & ((head << 32) ^ (head << 24) ^ ((uint64_t)((frame->address << 1) | 1) << 24)));
+  return head | tail;
+}
+
+static size_t verify_table(const LTC4162_trace_frame_t *frames, size_t count, uint8_t *failures)
+{
+  size_t bad = 0;
+  size_t i;
+  for (i = 0; i < count; i++)
+  {
+    uint64_t polynomial = frame_polynomial(&frames[i]);
+    uint8_t bytes[6];
+    uint8_t length = frames[i].read ? 6 : 5;
+    uint8_t j;
+    for (j = 0; j < length; j++) bytes[j] = polynomial >> (8 * (length - 1 - j));
+    uint8_t failed = pec_block(bytes, length, 0) != 0;
+    if (failures) failures[i] = failed;
+    bad += failed;
+  }
+  return bad;
+}
+
+#ifdef TRACE_CLMUL
+
+#define CRC8_POLYNOMIAL 0x107ull
+#define CRC8_BARRETT_MU 0x107156A166329DDull // floor(x^64 / CRC8_POLYNOMIAL)
+
+/* Remainder of a polynomial of degree below 64 modulo CRC8_POLYNOMIAL. The quotient is
+ * floor(floor(A / x^8) * mu / x^56), exact for this degree, and the remainder is the low byte of A + quotient * P.
+ */
+__attribute__((target("pclmul")))
+static inline uint8_t barrett_remainder(uint64_t polynomial)
+{
+  __m128i a = _mm_set_epi64x(0, (long long)polynomial);
+  __m128i quotient = _mm_clmulepi64_si128(_mm_srli_epi64(a, 8), _mm_set_epi64x(0, (long long)CRC8_BARRETT_MU), 0x00);
+  quotient = _mm_srli_si128(quotient, 7); // Divide by x^56
+  __m128i product = _mm_clmulepi64_si128(quotient, _mm_set_epi64x(0, (long long)CRC8_POLYNOMIAL), 0x00);
+  return (uint8_t)_mm_cvtsi128_si32(_mm_xor_si128(a, product));
+}
+
+__attribute__((target("pclmul")))
+static size_t verify_clmul(const LTC4162_trace_frame_t *frames, size_t count, uint8_t *failures)
+{
+  size_t bad = 0;
+  size_t i;
+  for (i = 0; i < count; i++)
+  {
+    uint8_t failed = barrett_remainder(frame_polynomial(&frames[i])) != 0;
+    if (failures) failures[i] = failed;
+    bad += failed;
+  }
+  return bad;
+}
+
+static int clmul_supported(void)
+{
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("pclmul");
+}
+
+#endif
+
+static size_t (*verify)(const LTC4162_trace_frame_t *, size_t, uint8_t *) = 0;
+
+int LTC4162_trace_clmul(int enable)
+{
+#ifdef TRACE_CLMUL
+  if (enable && clmul_supported())
+  {
+    verify = verify_clmul;
+    return 1;
+  }
+#else
+  (void)enable;
+#endif
+  verify = verify_table;
+  return 0;
+}
+
+size_t LTC4162_trace_verify(const LTC4162_trace_frame_t *frames, size_t count, uint8_t *failures)
+{
+  if (!verify) LTC4162_trace_clmul(1);
+  return verify(frames, count, failures);
+}
+
+#endif /* ARDUINO */
@@ -0,0 +1,199 @@
+/*!
+LTC4162: Advanced Synchronous Switching Battery Charger and PowerPath Manager
+
+@verbatim
+The LTC®4162-S is an advanced synchronous switching battery charger and
+PowerPath manager that seamlessly manages power distribution from input sources
+such as wall adapters, backplanes, solar panels, etc. and a rechargeable
+battery. A high resolution telemetry system provides extensive information on
+circuit voltages, currents, battery resistance and temperatures which can all be
+read back over the serial interface. The serial interface can also be used to
+configure many of the charging parameters as well as numerous system status
+alerts. The LTC4162-S can charge from one to four 6V Lead-Acid batteries or one
+to two 12V Lead-Acid batteries with up to 3.2A of charge current. The power path
+topology decouples the output voltage from the battery allowing a portable
+product to start up under very low battery voltage conditions. The LTC4162-S is
+available in an I²C adjustable version as well a fixed voltage version both with
+and without MPPT enabled by default. The LTC4162-S is available in the 28-pin
+4mm × 5mm × 0.75mm QFN surface mount package.
+@endverbatim
+
+http://www.linear.com/product/LTC4162
+
+http://www.linear.com/product/LTC4162#demoboards
+
+REVISION HISTORY
+$Revision$
+$Date$
+
+Copyright (c) 2018, Linear Technology Corp.(LTC)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1.  Redistributions  of source code must retain the above copyright notice, this
+    list  of conditions and the following disclaimer.
+
+2.  Redistributions  in  binary  form must reproduce the above copyright notice,
+    this  list of conditions and  the following disclaimer in the  documentation
+    and/or other materials provided with the distribution.
+
+THIS  SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY  EXPRESS  OR  IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES   OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY  DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING,  BUT  NOT  LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS  OF  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY  THEORY  OF  LIABILITY,  WHETHER  IN  CONTRACT,  STRICT  LIABILITY,  OR TORT
+(INCLUDING  NEGLIGENCE  OR  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The  views and conclusions contained in the software and documentation are those
+of  the authors and should not be interpreted as representing official policies,
+either expressed or implied, of Linear Technology Corp.
+
+The Linear Technology Linduino is not affiliated with the official Arduino team.
+However,  the Linduino is only possible because of the Arduino team's commitment
+to   the   open-source   community.   Please,  visit  http://www.arduino.cc  and
+http://store.arduino.cc,  and consider  a purchase  that  will  help fund  their
+ongoing work.
+
+Generated on: 2018-03-09
+*/
+
+/*! @file
+ *  @ingroup LTC4162-SAD
+ *  @brief LTC4162-SAD exception polling through the alert limit registers.
+ */
+
+#include "LTC4162-SAD_window.h"
+#include <stddef.h>
+
+/* Where each channel's reading is on the LTC4162 and in LTC4162_telemetry_t. BSR is the only unsigned reading. */
+static const struct
+{
+  uint8_t command_code;
+  uint8_t offset;
+  uint8_t is_signed;
+} channels[LTC4162_WINDOW_CHANNELS] =
+{
+  {LTC4162_VBAT_REG_SUBADDR, offsetof(LTC4162_telemetry_t, vbat), 1},
+  {LTC4162_VIN_REG_SUBADDR, offsetof(LTC4162_telemetry_t, vin), 1},
+  {LTC4162_VOUT_REG_SUBADDR, offsetof(LTC4162_telemetry_t, vout), 1},
+  {LTC4162_IIN_REG_SUBADDR, offsetof(LTC4162_telemetry_t, iin), 1},
+  {LTC4162_IBAT_REG_SUBADDR, offsetof(LTC4162_telemetry_t, ibat), 1},
+  {LTC4162_DIE_TEMP_REG_SUBADDR, offsetof(LTC4162_telemetry_t, die_temp), 1},
+  {LTC4162_BSR_REG_SUBADDR, offsetof(LTC4162_telemetry_t, bsr), 0},
+  {LTC4162_THERMISTOR_VOLTAGE_REG_SUBADDR, offsetof(LTC4162_telemetry_t, thermistor_voltage), 1}
+};
+
+/* The alert limit registers, the channel each watches, which side of the reading it sits and its bit in
+   LIMIT_ALERTS_REG, which EN_LIMIT_ALERTS_REG shares. */
+static const struct
+{
+  uint8_t command_code;
+  uint8_t channel;
+  int8_t side;
+  uint16_t alert;
+} limits[] =
+{
+  {LTC4162_VBAT_LO_ALERT_LIMIT_SUBADDR, LTC4162_WINDOW_VBAT, -1, LTC4162_VBAT_LO_ALERT_MASK},
+  {LTC4162_VBAT_HI_ALERT_LIMIT_SUBADDR, LTC4162_WINDOW_VBAT, 1, LTC4162_VBAT_HI_ALERT_MASK},
+  {LTC4162_VIN_LO_ALERT_LIMIT_SUBADDR, LTC4162_WINDOW_VIN, -1, LTC4162_VIN_LO_ALERT_MASK},
+  {LTC4162_VIN_HI_ALERT_LIMIT_SUBADDR, LTC4162_WINDOW_VIN, 1, LTC4162_VIN_HI_ALERT_MASK},
+  {LTC4162_VOUT_LO_ALERT_LIMIT_SUBADDR, LTC4162_WINDOW_VOUT, -1, LTC4162_VOUT_LO_ALERT_MASK},
+  {LTC4162_VOUT_HI_ALERT_LIMIT_SUBADDR, LTC4162_WINDOW_VOUT, 1, LTC4162_VOUT_HI_ALERT_MASK},
+  {LTC4162_IIN_HI_ALERT_LIMIT_SUBADDR, LTC4162_WINDOW_IIN, 1, LTC4162_IIN_HI_ALERT_MASK},
+  {LTC4162_IBAT_LO_ALERT_LIMIT_SUBADDR, LTC4162_WINDOW_IBAT, -1, LTC4162_IBAT_LO_ALERT_MASK},
+  {LTC4162_DIE_TEMP_HI_ALERT_LIMIT_SUBADDR, LTC4162_WINDOW_DIE_TEMP, 1, LTC4162_DIE_TEMP_HI_ALERT_MASK},
+  {LTC4162_BSR_HI_ALERT_LIMIT_SUBADDR, LTC4162_WINDOW_BSR, 1, LTC4162_BSR_HI_ALERT_MASK},
+  {LTC4162_THERMISTOR_VOLTAGE_HI_ALERT_LIMIT_SUBADDR, LTC4162_WINDOW_THERMISTOR_VOLTAGE, 1, LTC4162_THERMISTOR_VOLTAGE_HI_ALERT_MASK},
+  {LTC4162_THERMISTOR_VOLTAGE_LO_ALERT_LIMIT_SUBADDR, LTC4162_WINDOW_THERMISTOR_VOLTAGE, -1, LTC4162_THERMISTOR_VOLTAGE_LO_ALERT_MASK}
+};
+#define LIMIT_COUNT (sizeof(limits) / sizeof(limits[0]))
+#define LIMIT_ALERTS_MASK 0x0FFF    // Every bit in limits[], leaving telemetry_valid and bsr_done alone
+
+static uint16_t *reading(LTC4162_telemetry_t *telemetry, uint8_t channel)
+{
+  return (uint16_t *)((uint8_t *)telemetry + channels[channel].offset);
+}
+
+/* Moves the limits of one channel to either side of code, saturating at the ends of the A/D range. */
+static int centre(const LTC4162_window_t *window, LTC4162_chip_cfg_t *chip, uint8_t channel, uint16_t code)
+{
+  int32_t centre = channels[channel].is_signed ? (int16_t)code : code;
+  int32_t low = channels[channel].is_signed ? INT16_MIN : 0;
+  int32_t high = channels[channel].is_signed ? INT16_MAX : UINT16_MAX;
+  int32_t limit;
+  uint8_t i;
+  int failure = 0;
+  for (i = 0; i < LIMIT_COUNT && !failure; i++)
+  {
+    if (limits[i].channel != channel) continue;
+    limit = centre + limits[i].side * (int32_t)window->hysteresis[channel];
+    if (limit < low) limit = low;
+    if (limit > high) limit = high;
+    failure = LTC4162_write_bits(chip, limits[i].command_code, UINT16_MAX, (uint16_t)limit);
+  }
+  return failure;
+}
+
+void LTC4162_window_init(LTC4162_window_t *window, const uint16_t hysteresis[LTC4162_WINDOW_CHANNELS])
+{
+  uint8_t channel;
+  for (channel = 0; channel < LTC4162_WINDOW_CHANNELS; channel++)
+    window->hysteresis[channel] = hysteresis[channel];
+  window->armed = 0;
+  window->tripped = 0;
+  window->polls = 0;
+  window->trips = 0;
+  window->rereads = 0;
+}
+
+int LTC4162_window_arm(LTC4162_window_t *window, LTC4162_chip_cfg_t *chip, const LTC4162_telemetry_t *telemetry)
+{
+  LTC4162_alerts_t stale = {0, 0, 0};
+  uint16_t armed = 0;
+  uint8_t i;
+  int failure = 0;
+  for (i = 0; i < LIMIT_COUNT; i++)
+    if (window->hysteresis[limits[i].channel]) armed |= limits[i].alert;
+  for (i = 0; i < LTC4162_WINDOW_CHANNELS && !failure; i++)
+    if (window->hysteresis[i]) failure = centre(window, chip, i, *(const uint16_t *)((const uint8_t *)telemetry + channels[i].offset));
+  if (!failure) failure = LTC4162_write_bits(chip, LTC4162_EN_LIMIT_ALERTS_REG_SUBADDR, LIMIT_ALERTS_MASK, armed);
+  if (failure) return failure;
+  window->armed = armed;
+  stale.limit = LIMIT_ALERTS_MASK;    // After enabling, so nothing tripped by the old limits survives
+  return LTC4162_clear_alerts(chip, &stale);
+}
+
+int LTC4162_window_poll(LTC4162_window_t *window, LTC4162_chip_cfg_t *chip, LTC4162_telemetry_t *telemetry, uint32_t timestamp)
+{
+  LTC4162_alerts_t tripped = {0, 0, 0};
+  uint8_t moved = 0;    // Channels tripped, a bit each
+  uint8_t i;
+  int failure;
+  window->tripped = 0;
+  window->polls++;
+  failure = LTC4162_read_word(chip, LTC4162_LIMIT_ALERTS_REG_SUBADDR, &tripped.limit);
+  tripped.limit &= window->armed;
+  if (failure || !tripped.limit) return failure;
+  window->trips++;
+  for (i = 0; i < LIMIT_COUNT; i++)
+    if (tripped.limit & limits[i].alert) moved |= 1u << limits[i].channel;
+  for (i = 0; i < LTC4162_WINDOW_CHANNELS && !failure; i++)
+  {
+    if (!(moved & (1u << i))) continue;
+    failure = LTC4162_read_word(chip, channels[i].command_code, reading(telemetry, i));
+    if (failure) break;
+    window->rereads++;
+    failure = centre(window, chip, i, *reading(telemetry, i));
+  }
+  if (!failure) failure = LTC4162_clear_alerts(chip, &tripped);    // Only now, so a failed pass trips again on the next
+  if (failure) return failure;
+  telemetry->timestamp = timestamp;
+  window->tripped = tripped.limit;
+  return 0;
+}